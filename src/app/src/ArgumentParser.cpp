@@ -5,21 +5,32 @@
 using namespace App;
 
 void ArgumentParser::print_usage() {
-  std::cout << "Usage: shinobu [-h] filepath" << std::endl;
+  std::cout << "Usage: shinobu [-h] [-r movie.skm] [-p movie.skm] filepath"
+            << std::endl;
   std::cout << "" << std::endl;
   std::cout << "  -h   print this message" << std::endl;
+  std::cout << "  -r   record the joypad input into a movie" << std::endl;
+  std::cout << "  -p   play back the joypad input of a movie" << std::endl;
   std::cout << "" << std::endl;
 }
 
 // NOLINTNEXTLINE(modernize-avoid-c-arrays)
 auto ArgumentParser::parse(int argc, char *argv[]) -> Args {
+  Args args = {};
   int c;
-  while ((c = getopt(argc, argv, "h")) != -1) { // NOLINT(concurrency-mt-unsafe)
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  while ((c = getopt(argc, argv, "hr:p:")) != -1) {
     switch (c) {
     case 'h':
       print_usage();
       exit(0); // NOLINT(concurrency-mt-unsafe)
       break;
+    case 'r':
+      args.record_movie = std::filesystem::path(optarg);
+      break;
+    case 'p':
+      args.play_movie = std::filesystem::path(optarg);
+      break;
     case '?':
       print_usage();
       exit(1); // NOLINT(concurrency-mt-unsafe)
@@ -35,12 +46,11 @@ auto ArgumentParser::parse(int argc, char *argv[]) -> Args {
     exit(1); // NOLINT(concurrency-mt-unsafe)
   }
   char *path = argv[optind];
-  std::filesystem::path rom =
-      std::filesystem::current_path() / std::string(path);
-  if (!std::filesystem::exists(rom)) {
-    std::cout << "The filepath provided as argument: " << rom
+  args.rom = std::filesystem::current_path() / std::string(path);
+  if (!std::filesystem::exists(args.rom)) {
+    std::cout << "The filepath provided as argument: " << args.rom
               << " doesn't exist." << std::endl;
     exit(1); // NOLINT(concurrency-mt-unsafe)
   }
-  return {rom};
+  return args;
 }
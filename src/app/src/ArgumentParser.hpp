@@ -6,6 +6,8 @@
 namespace App {
 struct Args {
   std::filesystem::path rom;
+  std::filesystem::path record_movie;
+  std::filesystem::path play_movie;
 };
 
 class ArgumentParser {
@@ -2,12 +2,22 @@
 #include <common/Configuration.hpp>
 #include <cstring>
 #include <filesystem>
+#include <string>
 
 void App::Configuration::setup() {
   std::filesystem::path config_file_path =
       std::filesystem::current_path() / std::string("sakura.json");
   std::string contents = R"json(
 {
+  "audio": {
+    "enabled": "true"
+  },
+  "frame_handoff": {
+    "enabled": "false"
+  },
+  "frame_pacing": {
+    "mode": "audio"
+  },
   "log_formatter": {
     "enabled": "true"
   },
@@ -27,6 +37,20 @@ void App::Configuration::setup() {
   "mos_6502_mode": {
     "enabled": "false"
   },
+  "rewind": {
+    "capacity_mb": "16",
+    "enabled": "true",
+    "interval": "2"
+  },
+  "telemetry": {
+    "enabled": "false",
+    "path": "telemetry.csv"
+  },
+  "trace": {
+    "capacity": "1048576",
+    "enabled": "false",
+    "path": "sakura.trace"
+  },
   "vdc": {
     "deadbeef_vram": "false"
   }
@@ -77,3 +101,35 @@ auto App::Configuration::get_mos_6502_mode_config()
   return {.enabled =
               is_true(Common::Configuration::get("mos_6502_mode.enabled"))};
 }
+
+auto App::Configuration::get_frame_handoff_config() -> App::FrameHandoffConfig {
+  return {.enabled =
+              is_true(Common::Configuration::get("frame_handoff.enabled"))};
+}
+
+auto App::Configuration::get_audio_config() -> App::AudioConfig {
+  return {.enabled = is_true(Common::Configuration::get("audio.enabled"))};
+}
+
+auto App::Configuration::get_frame_pacing_config() -> App::FramePacingConfig {
+  return {.mode = Common::Configuration::get("frame_pacing.mode")};
+}
+
+auto App::Configuration::get_rewind_config() -> App::RewindConfig {
+  return {.enabled = is_true(Common::Configuration::get("rewind.enabled")),
+          .interval = static_cast<unsigned int>(
+              std::stoul(Common::Configuration::get("rewind.interval"))),
+          .capacity_mb =
+              std::stoul(Common::Configuration::get("rewind.capacity_mb"))};
+}
+
+auto App::Configuration::get_trace_config() -> App::TraceConfig {
+  return {.enabled = is_true(Common::Configuration::get("trace.enabled")),
+          .path = Common::Configuration::get("trace.path"),
+          .capacity = std::stoul(Common::Configuration::get("trace.capacity"))};
+}
+
+auto App::Configuration::get_telemetry_config() -> App::TelemetryConfig {
+  return {.enabled = is_true(Common::Configuration::get("telemetry.enabled")),
+          .path = Common::Configuration::get("telemetry.path")};
+}
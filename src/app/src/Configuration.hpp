@@ -2,12 +2,56 @@
 #define APP_CONFIGURATION_HPP
 #include <sakura/Emulator.hpp>
 
+namespace App {
+struct FrameHandoffConfig {
+  bool enabled;
+};
+
+struct AudioConfig {
+  bool enabled;
+};
+
+/*
+Possible values: "audio", "clock", "off". Audio pacing falls back to the clock
+when there is no audio device.
+*/
+struct FramePacingConfig {
+  std::string mode;
+};
+
+struct RewindConfig {
+  bool enabled;
+  // Frames between snapshots
+  unsigned int interval;
+  size_t capacity_mb;
+};
+
+struct TraceConfig {
+  bool enabled;
+  std::string path;
+  // Latest instructions kept, 16 bytes each
+  size_t capacity;
+};
+
+struct TelemetryConfig {
+  bool enabled;
+  // Histograms are written here on exit, nothing is written when empty
+  std::string path;
+};
+}; // namespace App
+
 namespace App::Configuration {
 void setup();
 auto get_log_level_config() -> Sakura::LogLevelConfig;
 auto get_vdc_config() -> Sakura::VDCConfig;
 auto get_log_formatter_config() -> Sakura::LogFormatterConfig;
 auto get_mos_6502_mode_config() -> Sakura::MOS6502ModeConfig;
+auto get_frame_handoff_config() -> App::FrameHandoffConfig;
+auto get_audio_config() -> App::AudioConfig;
+auto get_frame_pacing_config() -> App::FramePacingConfig;
+auto get_rewind_config() -> App::RewindConfig;
+auto get_trace_config() -> App::TraceConfig;
+auto get_telemetry_config() -> App::TelemetryConfig;
 }; // namespace App::Configuration
 
 #endif
@@ -0,0 +1,32 @@
+#include "Frame.hpp"
+
+using namespace App;
+
+void FrameCapture::capture(std::unique_ptr<Sakura::RendererInfo> &renderer_info,
+                           const ViewerRequests &requests, Frame &frame) {
+  m_sequence++;
+  frame.sequence = m_sequence;
+  frame.color_table_data = renderer_info->get_color_table_data();
+
+  // The VDC keeps collecting dirty cells while the viewer is hidden, the
+  // next capture renders all of them at once
+  if (requests.background.load(std::memory_order_relaxed)) {
+    const auto &background_data =
+        renderer_info->get_background_attribute_table_data(
+            frame.background_dirty_rectangles);
+    if (!frame.background_dirty_rectangles.empty()) {
+      m_background_version++;
+    }
+    if (frame.background_version != m_background_version) {
+      frame.background_data = background_data;
+      frame.background_version = m_background_version;
+    }
+    frame.background_dimensions =
+        renderer_info->get_background_attribute_table_dimensions();
+  }
+
+  if (requests.character_generator.load(std::memory_order_relaxed)) {
+    frame.character_generator_data =
+        renderer_info->get_character_generator_data();
+  }
+}
@@ -0,0 +1,55 @@
+#ifndef APP_FRAME_HPP
+#define APP_FRAME_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <sakura/Constants.hpp>
+#include <sakura/RendererInfo.hpp>
+#include <utility>
+#include <vector>
+
+namespace App {
+
+/*
+Everything the debug windows need to draw one emulated frame, captured on the
+emulator thread so the render thread never touches the controllers. The
+screen itself comes from a Sakura::FrameSink. The background and character
+generator viewers are megabytes of floats, they are only captured while
+their windows are visible and keep their previous contents otherwise.
+*/
+// Set by the render thread, read by the emulator thread
+struct ViewerRequests {
+  std::atomic<bool> background;
+  std::atomic<bool> character_generator;
+};
+
+struct Frame {
+  uint64_t sequence;
+  std::array<float, COLOR_TABLE_RAM_DATA_LENGTH> color_table_data;
+  // The background data is only copied when this buffer holds an older
+  // version, the dirty rectangles describe the changes from the previous one
+  // Rows are as long as the virtual screen in background_dimensions
+  std::vector<float> background_data;
+  uint64_t background_version;
+  std::vector<Sakura::DirtyRectangle> background_dirty_rectangles;
+  std::pair<unsigned int, unsigned int> background_dimensions;
+  std::array<float, CHARACTER_GENERATOR_DATA_LENGTH> character_generator_data;
+};
+
+class FrameCapture {
+private:
+  uint64_t m_sequence;
+  uint64_t m_background_version;
+
+public:
+  FrameCapture() : m_sequence(), m_background_version() {}
+  ~FrameCapture() = default;
+
+  void capture(std::unique_ptr<Sakura::RendererInfo> &renderer_info,
+               const ViewerRequests &requests, Frame &frame);
+};
+}; // namespace App
+
+#endif
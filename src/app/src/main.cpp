@@ -1,16 +1,54 @@
 #include "ArgumentParser.hpp"
 #include "Configuration.hpp"
+#include "Frame.hpp"
 #include <SDL2/SDL.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <fmt/core.h>
 #include <glad/glad.h>
 #include <grafx/Texture.hpp>
 #include <imgui_impl_opengl3.h>
 #include <imgui_impl_sdl.h>
+#include <fstream>
 #include <iostream>
+#include <mutex>
+#include <sakura/AudioRingBuffer.hpp>
 #include <sakura/Emulator.hpp>
+#include <sakura/FramePacer.hpp>
+#include <sakura/FrameSink.hpp>
+#include <sakura/InputMovie.hpp>
+#include <sakura/Joypad.hpp>
+#include <sakura/RewindBuffer.hpp>
+#include <sakura/Telemetry.hpp>
+#include <sakura/TripleBuffer.hpp>
+#include <thread>
+
+auto JOYPAD_BUTTON_FOR_KEY(SDL_Keycode key) -> uint8_t {
+  switch (key) {
+  case SDLK_UP:
+    return Sakura::JoypadButton::Up;
+  case SDLK_RIGHT:
+    return Sakura::JoypadButton::Right;
+  case SDLK_DOWN:
+    return Sakura::JoypadButton::Down;
+  case SDLK_LEFT:
+    return Sakura::JoypadButton::Left;
+  case SDLK_x:
+    return Sakura::JoypadButton::I;
+  case SDLK_z:
+    return Sakura::JoypadButton::II;
+  case SDLK_RSHIFT:
+    return Sakura::JoypadButton::Select;
+  case SDLK_RETURN:
+    return Sakura::JoypadButton::Run;
+  default:
+    return 0;
+  }
+}
 
 auto main(int argc, char *argv[]) -> int {
-  if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+  if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) != 0) {
     std::cout << "Error initializing SDL: " << SDL_GetError() << std::endl;
     exit(1); // NOLINT(concurrency-mt-unsafe)
   }
@@ -59,10 +97,16 @@ auto main(int argc, char *argv[]) -> int {
 
   const unsigned int texture_scale = 3;
 
-  Grafx::Texture background_texture = Grafx::Texture(
-      BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW *
-          CHARACTER_DOTS_WIDTH,
-      BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_ROWS * CHARACTER_DOTS_HEIGHT);
+  Grafx::Texture screen_texture =
+      Grafx::Texture(FRAME_BUFFER_MAX_WIDTH, FRAME_BUFFER_MAX_HEIGHT);
+
+  const unsigned int background_max_width =
+      BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_CHARACTERS_PER_ROW *
+      CHARACTER_DOTS_WIDTH;
+  const unsigned int background_max_height =
+      BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_ROWS * CHARACTER_DOTS_HEIGHT;
+  Grafx::Texture background_texture =
+      Grafx::Texture(background_max_width, background_max_height);
 
   Grafx::Texture character_generator_texture = Grafx::Texture(
       CHARACTER_GENERATOR_NUMBER_OF_CHARACTERS_PER_ROW * CHARACTER_DOTS_WIDTH,
@@ -74,15 +118,34 @@ auto main(int argc, char *argv[]) -> int {
   auto vdc_config = App::Configuration::get_vdc_config();
   auto log_formatter_config = App::Configuration::get_log_formatter_config();
   auto mos_6502_mode_config = App::Configuration::get_mos_6502_mode_config();
+  auto frame_handoff_config = App::Configuration::get_frame_handoff_config();
+  auto audio_config = App::Configuration::get_audio_config();
+  auto frame_pacing_config = App::Configuration::get_frame_pacing_config();
+  auto rewind_config = App::Configuration::get_rewind_config();
+  auto trace_config = App::Configuration::get_trace_config();
+  auto telemetry_config = App::Configuration::get_telemetry_config();
 
   App::Args configuration = App::ArgumentParser::parse(argc, argv);
 
-  Sakura::Emulator emulator =
-      Sakura::Emulator(vdc_config, mos_6502_mode_config);
-  emulator.set_vsync_callback([&](std::unique_ptr<Sakura::RendererInfo>
-                                      &renderer_info) {
-    emulator.set_should_pause();
+  std::unique_ptr<App::Frame> current_frame;
+  std::unique_ptr<Sakura::TripleBuffer<App::Frame>> frames;
 
+  auto frame_sink = std::make_shared<Sakura::FrameSink>();
+  auto screen_data =
+      std::make_unique<std::array<float, FRAME_BUFFER_DATA_LENGTH>>();
+  unsigned int screen_width = 0;
+  unsigned int screen_height = 0;
+  uint64_t uploaded_background_version = 0;
+  App::ViewerRequests viewer_requests = {};
+  viewer_requests.background = true;
+  viewer_requests.character_generator = true;
+  using Clock = Sakura::Telemetry::Clock;
+  std::unique_ptr<Sakura::Telemetry> telemetry;
+  if (telemetry_config.enabled) {
+    telemetry = std::make_unique<Sakura::Telemetry>();
+  }
+  auto draw = [&](const App::Frame &frame) {
+    Clock::time_point render_start = Clock::now();
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplSDL2_NewFrame(window);
 
@@ -92,7 +155,7 @@ auto main(int argc, char *argv[]) -> int {
                        ImGuiWindowFlags_AlwaysAutoResize)) {
         if (ImGui::BeginTabBar("color-table-ram", ImGuiTabBarFlags_None)) {
           const int color_button_side = 20;
-          auto color_table_data = renderer_info->get_color_table_data();
+          const auto &color_table_data = frame.color_table_data;
           for (unsigned int color_table_ram_area = 0;
                color_table_ram_area < COLOR_TABLE_RAM_NUMBER_OF_AREAS;
                color_table_ram_area++) {
@@ -136,38 +199,87 @@ auto main(int argc, char *argv[]) -> int {
         }
       }
       ImGui::End();
-      if (ImGui::Begin("Background", nullptr,
+      if (frame_sink->consume()) {
+        const Sakura::Frame &screen = frame_sink->front();
+        screen.get_rgb_data(*screen_data);
+        screen_width = screen.width;
+        screen_height = screen.height;
+        screen_texture.bind(GL_TEXTURE0);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, screen_width, screen_height,
+                        GL_RGB, GL_FLOAT, screen_data->data());
+      }
+      if (ImGui::Begin("Screen", nullptr,
                        ImGuiWindowFlags_AlwaysAutoResize)) {
-        background_texture.bind(GL_TEXTURE0);
-        glTexSubImage2D(
-            GL_TEXTURE_2D, 0, 0, 0,
-            BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW *
-                CHARACTER_DOTS_WIDTH,
-            BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_ROWS * CHARACTER_DOTS_HEIGHT,
-            GL_RGB, GL_FLOAT,
-            renderer_info->get_background_attribute_table_data().data());
-        ImVec2 size = ImVec2(
-            static_cast<float>(
-                BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW *
-                CHARACTER_DOTS_WIDTH * texture_scale),
-            static_cast<float>(BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_ROWS *
-                               CHARACTER_DOTS_HEIGHT * texture_scale));
+        ImVec2 size =
+            ImVec2(static_cast<float>(screen_width * texture_scale),
+                   static_cast<float>(screen_height * texture_scale));
+        ImVec2 uv1 = ImVec2(
+            static_cast<float>(screen_width) / FRAME_BUFFER_MAX_WIDTH,
+            static_cast<float>(screen_height) / FRAME_BUFFER_MAX_HEIGHT);
+        ImGui::Image(
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            reinterpret_cast<ImTextureID>(screen_texture.get_object()), size,
+            ImVec2(0, 0), uv1);
+      }
+      ImGui::End();
+
+      bool background_visible = ImGui::Begin(
+          "Background", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+      if (background_visible) {
+        // The texture is sized for the largest virtual screen, only the area
+        // selected by MWR is uploaded and shown
+        auto [background_width, background_height] =
+            frame.background_dimensions;
+        // Only the regions that changed since the previous upload are sent,
+        // when frames were dropped or the viewer was hidden in between, the
+        // whole background is uploaded instead
+        if (frame.background_version != uploaded_background_version) {
+          background_texture.bind(GL_TEXTURE0);
+          glPixelStorei(GL_UNPACK_ROW_LENGTH, background_width);
+          if (!frame.background_dirty_rectangles.empty() &&
+              frame.background_version == uploaded_background_version + 1) {
+            for (const auto &rectangle : frame.background_dirty_rectangles) {
+              glTexSubImage2D(
+                  GL_TEXTURE_2D, 0, rectangle.x, rectangle.y, rectangle.width,
+                  rectangle.height, GL_RGB, GL_FLOAT,
+                  &frame.background_data[(rectangle.x +
+                                          rectangle.y * background_width) *
+                                         3]);
+            }
+          } else if (!frame.background_data.empty()) {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, background_width,
+                            background_height, GL_RGB, GL_FLOAT,
+                            frame.background_data.data());
+          }
+          glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+          uploaded_background_version = frame.background_version;
+        }
+        ImVec2 size =
+            ImVec2(static_cast<float>(background_width * texture_scale),
+                   static_cast<float>(background_height * texture_scale));
+        ImVec2 uv1 =
+            ImVec2(static_cast<float>(background_width) / background_max_width,
+                   static_cast<float>(background_height) /
+                       background_max_height);
         ImGui::Image(
             // NOLINTNEXTLINE(performance-no-int-to-ptr)
             reinterpret_cast<ImTextureID>(background_texture.get_object()),
-            size);
+            size, ImVec2(0, 0), uv1);
       }
       ImGui::End();
+      viewer_requests.background.store(background_visible,
+                                       std::memory_order_relaxed);
 
-      if (ImGui::Begin("Character Generator", nullptr,
-                       ImGuiWindowFlags_AlwaysAutoResize)) {
+      bool character_generator_visible = ImGui::Begin(
+          "Character Generator", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+      if (character_generator_visible) {
         character_generator_texture.bind(GL_TEXTURE0);
         glTexSubImage2D(
             GL_TEXTURE_2D, 0, 0, 0,
             CHARACTER_GENERATOR_NUMBER_OF_CHARACTERS_PER_ROW *
                 CHARACTER_DOTS_WIDTH,
             CHARACTER_GENERATOR_NUMBER_OF_ROWS * CHARACTER_DOTS_HEIGHT, GL_RGB,
-            GL_FLOAT, renderer_info->get_character_generator_data().data());
+            GL_FLOAT, frame.character_generator_data.data());
         ImVec2 size =
             ImVec2(static_cast<float>(
                        CHARACTER_GENERATOR_NUMBER_OF_CHARACTERS_PER_ROW *
@@ -181,6 +293,30 @@ auto main(int argc, char *argv[]) -> int {
             size);
       }
       ImGui::End();
+      viewer_requests.character_generator.store(character_generator_visible,
+                                                std::memory_order_relaxed);
+
+      if (telemetry) {
+        if (ImGui::Begin("Telemetry", nullptr,
+                         ImGuiWindowFlags_AlwaysAutoResize)) {
+          ImGui::Text("%-16s %8s %8s %8s %8s", "Phase (ms)", "p50", "p95",
+                      "p99", "max");
+          for (size_t phase = 0; phase < Sakura::TELEMETRY_NUMBER_OF_PHASES;
+               phase++) {
+            auto telemetry_phase = static_cast<Sakura::TelemetryPhase>(phase);
+            auto statistics = telemetry->get_statistics(telemetry_phase);
+            const double nanoseconds_per_ms = 1e6;
+            ImGui::Text(
+                "%-16s %8.3f %8.3f %8.3f %8.3f",
+                Sakura::Telemetry::get_phase_name(telemetry_phase),
+                static_cast<double>(statistics.p50) / nanoseconds_per_ms,
+                static_cast<double>(statistics.p95) / nanoseconds_per_ms,
+                static_cast<double>(statistics.p99) / nanoseconds_per_ms,
+                static_cast<double>(statistics.max) / nanoseconds_per_ms);
+          }
+        }
+        ImGui::End();
+      }
     }
     ImGui::Render();
 
@@ -192,26 +328,261 @@ auto main(int argc, char *argv[]) -> int {
     glClear(GL_COLOR_BUFFER_BIT);
 
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    Clock::time_point present_start = Clock::now();
     SDL_GL_SwapWindow(window);
-  });
+    if (telemetry) {
+      telemetry->record(Sakura::TelemetryPhase::Render,
+                        present_start - render_start);
+      telemetry->record(Sakura::TelemetryPhase::Present,
+                        Clock::now() - present_start);
+    }
+  };
+
+  Sakura::Emulator emulator =
+      Sakura::Emulator(vdc_config, mos_6502_mode_config);
+  emulator.attach_frame_sink(frame_sink);
+
+  // About 85 ms at 48 kHz, dynamic rate control keeps it half full
+  const size_t audio_ring_buffer_capacity = 4096;
+  const uint16_t audio_device_samples = 512;
+  const double max_audio_rate_deviation = 0.005;
+  auto audio_ring_buffer =
+      std::make_shared<Sakura::AudioRingBuffer>(audio_ring_buffer_capacity);
+  SDL_AudioDeviceID audio_device = 0;
+  if (audio_config.enabled) {
+    SDL_AudioSpec desired = {};
+    desired.freq = AUDIO_SAMPLE_RATE;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = audio_device_samples;
+    desired.callback = [](void *userdata, Uint8 *stream, int length) {
+      auto *ring_buffer = static_cast<Sakura::AudioRingBuffer *>(userdata);
+      ring_buffer->read(reinterpret_cast<int16_t *>(stream),
+                        length / (sizeof(int16_t) * 2));
+    };
+    desired.userdata = audio_ring_buffer.get();
+    SDL_AudioSpec obtained = {};
+    audio_device = SDL_OpenAudioDevice(nullptr, 0, &desired, &obtained,
+                                       SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+    if (audio_device == 0) {
+      std::cout << "Error opening audio device: " << SDL_GetError()
+                << std::endl;
+    } else {
+      emulator.set_audio_sample_rate(obtained.freq);
+      emulator.attach_audio_ring_buffer(audio_ring_buffer);
+    }
+  }
+  // Runs on the emulator thread, nudges the resampling ratio towards a half
+  // full ring buffer so latency stays low without starving the device
+  auto adjust_audio_rate = [&] {
+    if (audio_device == 0) {
+      return;
+    }
+    double fill_level =
+        static_cast<double>(audio_ring_buffer->get_fill_level()) /
+        static_cast<double>(audio_ring_buffer->get_capacity());
+    emulator.set_audio_rate_adjustment(1.0 + (0.5 - fill_level) * 2.0 *
+                                                 max_audio_rate_deviation);
+  };
+
+  App::FrameCapture frame_capture = App::FrameCapture();
+  // The render thread sleeps until a frame is published, the timeout keeps
+  // input responsive while the emulator thread is slow or stalled
+  std::mutex frame_mutex;
+  std::condition_variable frame_published;
+  const auto frame_wait_timeout = std::chrono::milliseconds(20);
+  // Time spent in the callback, drawing included, is taken out of the
+  // emulation phase
+  Clock::duration vsync_callback_duration = {};
+  auto record_vsync_callback = [&](Clock::time_point start) {
+    Clock::duration duration = Clock::now() - start;
+    vsync_callback_duration += duration;
+    if (telemetry) {
+      telemetry->record(Sakura::TelemetryPhase::VsyncCallback, duration);
+    }
+  };
+  if (frame_handoff_config.enabled) {
+    // The emulator thread only captures and publishes frames, it never waits
+    // for the UI to be drawn or for the buffers to be swapped
+    frames = std::make_unique<Sakura::TripleBuffer<App::Frame>>();
+    emulator.set_vsync_callback(
+        [&](std::unique_ptr<Sakura::RendererInfo> &renderer_info) {
+          Clock::time_point start = Clock::now();
+          emulator.set_should_pause();
+          adjust_audio_rate();
+          frame_capture.capture(renderer_info, viewer_requests,
+                                frames->back());
+          {
+            std::lock_guard<std::mutex> lock(frame_mutex);
+            frames->publish();
+          }
+          frame_published.notify_one();
+          record_vsync_callback(start);
+        });
+  } else {
+    current_frame = std::make_unique<App::Frame>();
+    emulator.set_vsync_callback(
+        [&](std::unique_ptr<Sakura::RendererInfo> &renderer_info) {
+          Clock::time_point start = Clock::now();
+          emulator.set_should_pause();
+          adjust_audio_rate();
+          frame_capture.capture(renderer_info, viewer_requests,
+                                *current_frame);
+          record_vsync_callback(start);
+          Clock::time_point draw_start = Clock::now();
+          draw(*current_frame);
+          vsync_callback_duration += Clock::now() - draw_start;
+        });
+  }
+  std::unique_ptr<Sakura::FramePacer> frame_pacer;
+  if (frame_pacing_config.mode != "off") {
+    frame_pacer = std::make_unique<Sakura::FramePacer>(FRAME_RATE);
+    if (frame_pacing_config.mode == "audio" && audio_device != 0) {
+      frame_pacer->set_audio_ring_buffer(audio_ring_buffer,
+                                         audio_ring_buffer_capacity / 2);
+    }
+    // The pacer owns timing, presenting must not wait for the display
+    SDL_GL_SetSwapInterval(0);
+  }
+  auto pace = [&] {
+    if (frame_pacer) {
+      frame_pacer->wait();
+    }
+  };
+  // Holding backspace steps back one snapshot per frame
+  std::unique_ptr<Sakura::RewindBuffer> rewind_buffer;
+  if (rewind_config.enabled) {
+    rewind_buffer = std::make_unique<Sakura::RewindBuffer>(
+        rewind_config.capacity_mb * 1024 * 1024, rewind_config.interval);
+  }
+  std::atomic<bool> rewinding(false);
+  // F9 prints the opcode profile between two frames
+  std::atomic<bool> print_opcode_profile(false);
+  auto run_frame = [&] {
+    if (print_opcode_profile.exchange(false, std::memory_order_relaxed)) {
+      std::cout << emulator.get_opcode_profiler()->get_report();
+    }
+    if (rewind_buffer) {
+      if (rewinding.load(std::memory_order_relaxed)) {
+        rewind_buffer->rewind(emulator);
+      } else {
+        rewind_buffer->push(emulator);
+      }
+    }
+    vsync_callback_duration = {};
+    Clock::time_point start = Clock::now();
+    emulator.emulate();
+    if (telemetry) {
+      telemetry->record(Sakura::TelemetryPhase::Emulation,
+                        Clock::now() - start - vsync_callback_duration);
+    }
+    pace();
+  };
+  std::shared_ptr<Sakura::InputMovie> input_movie;
+  if (!configuration.play_movie.empty()) {
+    input_movie = std::make_shared<Sakura::InputMovie>();
+    if (!input_movie->load(configuration.play_movie)) {
+      std::cout << "Unable to load input movie: " << configuration.play_movie
+                << std::endl;
+      exit(1); // NOLINT(concurrency-mt-unsafe)
+    }
+    emulator.attach_input_movie(input_movie, Sakura::InputMovieMode::Playback);
+  } else if (!configuration.record_movie.empty()) {
+    input_movie = std::make_shared<Sakura::InputMovie>();
+    emulator.attach_input_movie(input_movie, Sakura::InputMovieMode::Record);
+  }
+  if (trace_config.enabled) {
+    auto trace_buffer = std::make_shared<Sakura::TraceBuffer>();
+    if (!trace_buffer->open(trace_config.path, trace_config.capacity)) {
+      std::cout << "Unable to open trace: " << trace_config.path << std::endl;
+      exit(1); // NOLINT(concurrency-mt-unsafe)
+    }
+    emulator.attach_trace_buffer(trace_buffer);
+  }
+  uint8_t joypad_buttons = 0;
   emulator.initialize(configuration.rom, log_level_config,
                       log_formatter_config);
+  if (audio_device != 0) {
+    SDL_PauseAudioDevice(audio_device, 0);
+  }
 
-  bool quit = false;
-  while (!quit) {
+  std::atomic<bool> quit(false);
+  std::thread emulator_thread;
+  if (frame_handoff_config.enabled) {
+    emulator_thread = std::thread([&] {
+      while (!quit.load(std::memory_order_relaxed)) {
+        run_frame();
+      }
+    });
+  }
+  while (!quit.load(std::memory_order_relaxed)) {
     SDL_Event event;
     while (SDL_PollEvent(&event) != 0) {
       ImGui_ImplSDL2_ProcessEvent(&event);
       if (event.type == SDL_QUIT) {
         quit = true;
       }
+      if ((event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) &&
+          event.key.repeat == 0) {
+        if (event.key.keysym.sym == SDLK_BACKSPACE) {
+          rewinding = event.type == SDL_KEYDOWN;
+        }
+        if (event.key.keysym.sym == SDLK_F9 && event.type == SDL_KEYDOWN &&
+            Sakura::OpcodeProfiler::is_compiled_in()) {
+          print_opcode_profile = true;
+        }
+        uint8_t button = JOYPAD_BUTTON_FOR_KEY(event.key.keysym.sym);
+        if (event.type == SDL_KEYDOWN) {
+          joypad_buttons |= button;
+        } else {
+          joypad_buttons &= ~button;
+        }
+        emulator.set_joypad_buttons(joypad_buttons);
+      }
     }
-    uint32_t frame_time = SDL_GetTicks();
-    emulator.emulate();
-    frame_time = SDL_GetTicks() - frame_time;
-    std::cout << "Frame time: " << std::dec << frame_time << std::endl;
+    if (frame_handoff_config.enabled) {
+      std::unique_lock<std::mutex> lock(frame_mutex);
+      bool consumed = frame_published.wait_for(
+          lock, frame_wait_timeout, [&] { return frames->consume(); });
+      lock.unlock();
+      if (consumed) {
+        draw(frames->front());
+      }
+      continue;
+    }
+    run_frame();
+  }
+  if (emulator_thread.joinable()) {
+    emulator_thread.join();
+  }
+  if (Sakura::OpcodeProfiler::is_compiled_in()) {
+    std::cout << emulator.get_opcode_profiler()->get_report();
+  }
+  if (configuration.play_movie.empty() &&
+      !configuration.record_movie.empty() &&
+      !input_movie->save(configuration.record_movie)) {
+    std::cout << "Unable to save input movie: " << configuration.record_movie
+              << std::endl;
+  }
+  if (telemetry && !telemetry_config.path.empty()) {
+    std::ofstream file = std::ofstream(telemetry_config.path, std::ios::out);
+    file << telemetry->get_csv();
+  }
+  if (frame_pacer) {
+    auto statistics = frame_pacer->get_statistics();
+    std::cout << fmt::format(
+                     "Frame pacing: {} frames, {:.3f} ms average interval, "
+                     "{:.3f} ms average jitter, {:.3f} ms max jitter, {} late, "
+                     "{:.0f}% idle",
+                     statistics.frames, statistics.average_interval_ms,
+                     statistics.average_jitter_ms, statistics.max_jitter_ms,
+                     statistics.late_frames, statistics.idle_ratio * 100.0)
+              << std::endl;
   }
 
+  if (audio_device != 0) {
+    SDL_CloseAudioDevice(audio_device);
+  }
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplSDL2_Shutdown();
   ImGui::DestroyContext();
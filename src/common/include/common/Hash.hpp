@@ -0,0 +1,15 @@
+#ifndef COMMON_HASH_HPP
+#define COMMON_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Common {
+namespace Hash {
+
+// XXH64, fast and non-cryptographic, for comparing large buffers
+auto xxh64(const void *data, size_t length, uint64_t seed = 0) -> uint64_t;
+}; // namespace Hash
+}; // namespace Common
+
+#endif
@@ -7,14 +7,19 @@ static nlohmann::json g_configuration;
 
 void Common::Configuration::setup(const std::filesystem::path &path,
                                   const std::string &contents) {
+  g_configuration = nlohmann::json::parse(contents);
   std::fstream in_file = std::fstream(path);
   if (in_file.good()) {
     std::stringstream buffer;
     buffer << in_file.rdbuf();
-    g_configuration = nlohmann::json::parse(buffer.str());
-    return;
+    nlohmann::json user_configuration = nlohmann::json::parse(buffer.str());
+    // Files written by older versions lack the newer keys, they keep their
+    // defaults and are added to the file
+    g_configuration.merge_patch(user_configuration);
+    if (g_configuration == user_configuration) {
+      return;
+    }
   }
-  g_configuration = nlohmann::json::parse(contents);
   std::ofstream out_file = std::ofstream();
   out_file.open(path);
   out_file << std::setw(4) << g_configuration << std::endl;
@@ -0,0 +1,84 @@
+#include "common/Hash.hpp"
+#include <cstring>
+
+const uint64_t G_PRIME_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t G_PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t G_PRIME_3 = 0x165667B19E3779F9ULL;
+const uint64_t G_PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t G_PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+auto ROTATE_LEFT(uint64_t value, unsigned int bits) -> uint64_t {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+// Host byte order, hashes are only compared within a process
+template <typename T> auto LOAD(const uint8_t *data) -> T {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+auto XXH_ROUND(uint64_t accumulator, uint64_t input) -> uint64_t {
+  accumulator += input * G_PRIME_2;
+  accumulator = ROTATE_LEFT(accumulator, 31);
+  return accumulator * G_PRIME_1;
+}
+
+auto XXH_MERGE_ROUND(uint64_t hash, uint64_t accumulator) -> uint64_t {
+  hash ^= XXH_ROUND(0, accumulator);
+  return hash * G_PRIME_1 + G_PRIME_4;
+}
+
+auto Common::Hash::xxh64(const void *data, size_t length, uint64_t seed)
+    -> uint64_t {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  const uint8_t *end = bytes + length;
+  uint64_t hash = 0;
+
+  if (length >= 32) {
+    // Four independent lanes over 32 byte stripes
+    uint64_t lane_1 = seed + G_PRIME_1 + G_PRIME_2;
+    uint64_t lane_2 = seed + G_PRIME_2;
+    uint64_t lane_3 = seed;
+    uint64_t lane_4 = seed - G_PRIME_1;
+    const uint8_t *limit = end - 32;
+    do {
+      lane_1 = XXH_ROUND(lane_1, LOAD<uint64_t>(bytes));
+      lane_2 = XXH_ROUND(lane_2, LOAD<uint64_t>(bytes + 8));
+      lane_3 = XXH_ROUND(lane_3, LOAD<uint64_t>(bytes + 16));
+      lane_4 = XXH_ROUND(lane_4, LOAD<uint64_t>(bytes + 24));
+      bytes += 32;
+    } while (bytes <= limit);
+    hash = ROTATE_LEFT(lane_1, 1) + ROTATE_LEFT(lane_2, 7) +
+           ROTATE_LEFT(lane_3, 12) + ROTATE_LEFT(lane_4, 18);
+    hash = XXH_MERGE_ROUND(hash, lane_1);
+    hash = XXH_MERGE_ROUND(hash, lane_2);
+    hash = XXH_MERGE_ROUND(hash, lane_3);
+    hash = XXH_MERGE_ROUND(hash, lane_4);
+  } else {
+    hash = seed + G_PRIME_5;
+  }
+  hash += length;
+
+  for (; bytes + 8 <= end; bytes += 8) {
+    hash ^= XXH_ROUND(0, LOAD<uint64_t>(bytes));
+    hash = ROTATE_LEFT(hash, 27) * G_PRIME_1 + G_PRIME_4;
+  }
+  if (bytes + 4 <= end) {
+    hash ^= LOAD<uint32_t>(bytes) * G_PRIME_1;
+    hash = ROTATE_LEFT(hash, 23) * G_PRIME_2 + G_PRIME_3;
+    bytes += 4;
+  }
+  for (; bytes < end; bytes++) {
+    hash ^= *bytes * G_PRIME_5;
+    hash = ROTATE_LEFT(hash, 11) * G_PRIME_1;
+  }
+
+  // Avalanche
+  hash ^= hash >> 33;
+  hash *= G_PRIME_2;
+  hash ^= hash >> 29;
+  hash *= G_PRIME_3;
+  hash ^= hash >> 32;
+  return hash;
+}
@@ -1,7 +1,13 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
 #include <common/Bits.hpp>
+#include <common/Configuration.hpp>
+#include <common/Hash.hpp>
 #include <common/Range.hpp>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <sstream>
 #include <vector>
 
 TEST_CASE("Bit test power of two numbers", "[test_power_of_2]") {
@@ -45,3 +51,51 @@ TEST_CASE("Test ranges between two numbers", "[range_contains]") {
     REQUIRE(test_case.result == range.contains(test_case.number));
   }
 }
+
+TEST_CASE("Hash buffers with XXH64", "[xxh64]") {
+  struct TestCase {
+    size_t length;
+    uint64_t seed;
+    uint64_t result;
+  };
+  // Bytes counting up from zero, lengths cover every tail of the algorithm
+  std::vector<uint8_t> data(100);
+  std::iota(data.begin(), data.end(), 0);
+  std::vector<TestCase> test_cases = {
+      {.length = 0, .seed = 0, .result = 0xEF46DB3751D8E999},
+      {.length = 47, .seed = 0, .result = 0x0D9883A03E7BFBB8},
+      {.length = 47, .seed = 0x9E3779B97F4A7C15, .result = 0x6CA09F82BDE16801},
+      {.length = 100, .seed = 0, .result = 0x6AC1E58032166597}};
+  for (auto &test_case : test_cases) {
+    REQUIRE(test_case.result ==
+            Common::Hash::xxh64(data.data(), test_case.length, test_case.seed));
+  }
+  REQUIRE(Common::Hash::xxh64("abc", 3) == 0x44BC2CF5AD770999);
+  REQUIRE(Common::Hash::xxh64("abc", 3, 1) == 0xBEA9CA8199328908);
+}
+
+TEST_CASE("Configuration files get the keys added after them",
+          "[configuration]") {
+  std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "sakura-configuration.json";
+  {
+    std::ofstream file = std::ofstream(path);
+    file << R"json({"audio": {"enabled": "false"}})json";
+  }
+  std::string defaults = R"json(
+{
+  "audio": {"enabled": "true", "latency": "4096"},
+  "trace": {"enabled": "false"}
+}
+  )json";
+  Common::Configuration::setup(path, defaults);
+  REQUIRE(Common::Configuration::get("audio.enabled") == "false");
+  REQUIRE(Common::Configuration::get("audio.latency") == "4096");
+  REQUIRE(Common::Configuration::get("trace.enabled") == "false");
+
+  std::stringstream contents;
+  contents << std::ifstream(path).rdbuf();
+  std::filesystem::remove(path);
+  REQUIRE(contents.str().find("latency") != std::string::npos);
+  REQUIRE(contents.str().find("\"trace\"") != std::string::npos);
+}
@@ -0,0 +1,160 @@
+#include "ArgumentParser.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+using namespace Headless;
+
+const uint64_t G_DEFAULT_FRAMES = 60;
+
+void ArgumentParser::print_usage() {
+  std::cout << "Usage: sakura-headless [-h] [-f frames] [-c cycles] "
+               "[-o framebuffer.ppm] [-v vram.bin] [-w audio.wav] "
+               "[-l state.bin] [-s state.bin] [-p movie.skm] [-k cycles] "
+               "[-g stacks.folded] [-t trace.bin] "
+               "[-d instruction|block|frame] filepath"
+            << std::endl;
+  std::cout << "" << std::endl;
+  std::cout << "  -h   print this message" << std::endl;
+  std::cout << "  -f   number of frames to run (default: 60)" << std::endl;
+  std::cout << "  -c   number of cycles to run, takes precedence over -f"
+            << std::endl;
+  std::cout << "  -o   dump the last frame as a binary PPM image" << std::endl;
+  std::cout << "  -v   dump VRAM as raw little-endian words" << std::endl;
+  std::cout << "  -w   record the PSG output as a 16-bit stereo WAV file"
+            << std::endl;
+  std::cout << "  -l   load a save state before running" << std::endl;
+  std::cout << "  -s   write a save state after running" << std::endl;
+  std::cout << "  -p   play back an input movie, runs up to its last input "
+               "unless -f is given"
+            << std::endl;
+  std::cout << "  -k   sample the program counter every number of cycles and "
+               "print the hottest addresses"
+            << std::endl;
+  std::cout << "  -g   profile guest calls, write folded stacks for flame "
+               "graphs and print the costliest functions"
+            << std::endl;
+  std::cout << "  -t   trace the latest instructions into a binary ring "
+               "buffer, decode it with sakura-trace"
+            << std::endl;
+  std::cout << "  -d   run a second emulator in lockstep, compare them after "
+               "every instruction, block of cycles or frame and report where "
+               "they diverge"
+            << std::endl;
+  std::cout << "" << std::endl;
+}
+
+auto ArgumentParser::parse_count(const char *value) -> uint64_t {
+  char *end = nullptr;
+  uint64_t count = std::strtoull(value, &end, 10);
+  if (end == value || *end != '\0' || count == 0) {
+    print_usage();
+    std::cout << "Invalid count: " << value << std::endl;
+    exit(1); // NOLINT(concurrency-mt-unsafe)
+  }
+  return count;
+}
+
+auto ArgumentParser::parse_granularity(const char *value)
+    -> Sakura::LockstepGranularity {
+  std::string granularity = std::string(value);
+  if (granularity == "instruction") {
+    return Sakura::LockstepGranularity::Instruction;
+  }
+  if (granularity == "block") {
+    return Sakura::LockstepGranularity::Block;
+  }
+  if (granularity == "frame") {
+    return Sakura::LockstepGranularity::Frame;
+  }
+  print_usage();
+  std::cout << "Invalid lockstep granularity: " << value << std::endl;
+  exit(1); // NOLINT(concurrency-mt-unsafe)
+}
+
+// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+auto ArgumentParser::parse(int argc, char *argv[]) -> Args {
+  Args args = {.rom = {},
+               .frames = 0,
+               .cycles = 0,
+               .frame_buffer = {},
+               .vram = {},
+               .audio = {},
+               .load_state = {},
+               .save_state = {},
+               .movie = {},
+               .pc_sample_interval = 0,
+               .call_stacks = {},
+               .trace = {},
+               .lockstep = {}};
+  int c;
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  while ((c = getopt(argc, argv, "hf:c:o:v:w:l:s:p:k:g:t:d:")) != -1) {
+    switch (c) {
+    case 'h':
+      print_usage();
+      exit(0); // NOLINT(concurrency-mt-unsafe)
+      break;
+    case 'f':
+      args.frames = parse_count(optarg);
+      break;
+    case 'c':
+      args.cycles = parse_count(optarg);
+      break;
+    case 'o':
+      args.frame_buffer = std::filesystem::path(optarg);
+      break;
+    case 'v':
+      args.vram = std::filesystem::path(optarg);
+      break;
+    case 'w':
+      args.audio = std::filesystem::path(optarg);
+      break;
+    case 'l':
+      args.load_state = std::filesystem::path(optarg);
+      break;
+    case 's':
+      args.save_state = std::filesystem::path(optarg);
+      break;
+    case 'p':
+      args.movie = std::filesystem::path(optarg);
+      break;
+    case 'k':
+      args.pc_sample_interval = parse_count(optarg);
+      break;
+    case 'g':
+      args.call_stacks = std::filesystem::path(optarg);
+      break;
+    case 't':
+      args.trace = std::filesystem::path(optarg);
+      break;
+    case 'd':
+      args.lockstep = parse_granularity(optarg);
+      break;
+    case '?':
+      print_usage();
+      exit(1); // NOLINT(concurrency-mt-unsafe)
+      break;
+    default:
+      std::cout << "Unexpected error while parsing options." << std::endl;
+      exit(1); // NOLINT(concurrency-mt-unsafe)
+    }
+  }
+  if (args.frames == 0 && args.movie.empty()) {
+    args.frames = G_DEFAULT_FRAMES;
+  }
+  if (optind >= argc) {
+    print_usage();
+    std::cout << "Missing argument: ROM filepath." << std::endl;
+    exit(1); // NOLINT(concurrency-mt-unsafe)
+  }
+  char *path = argv[optind];
+  args.rom = std::filesystem::current_path() / std::string(path);
+  if (!std::filesystem::exists(args.rom)) {
+    std::cout << "The filepath provided as argument: " << args.rom
+              << " doesn't exist." << std::endl;
+    exit(1); // NOLINT(concurrency-mt-unsafe)
+  }
+  return args;
+}
@@ -0,0 +1,44 @@
+#ifndef HEADLESS_ARGUMENT_PARSER_HPP
+#define HEADLESS_ARGUMENT_PARSER_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <sakura/Lockstep.hpp>
+
+namespace Headless {
+struct Args {
+  std::filesystem::path rom;
+  // Zero when it has to be taken from the movie
+  uint64_t frames;
+  uint64_t cycles;
+  std::filesystem::path frame_buffer;
+  std::filesystem::path vram;
+  std::filesystem::path audio;
+  std::filesystem::path load_state;
+  std::filesystem::path save_state;
+  std::filesystem::path movie;
+  // Zero when the program counter is not sampled
+  uint64_t pc_sample_interval;
+  // Folded call stacks, empty when calls are not profiled
+  std::filesystem::path call_stacks;
+  // Binary instruction trace, empty when not tracing
+  std::filesystem::path trace;
+  // Runs a second emulator alongside and stops where they diverge
+  std::optional<Sakura::LockstepGranularity> lockstep;
+};
+
+class ArgumentParser {
+private:
+  static void print_usage();
+  static auto parse_count(const char *value) -> uint64_t;
+  static auto parse_granularity(const char *value)
+      -> Sakura::LockstepGranularity;
+
+public:
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  static auto parse(int argc, char *argv[]) -> Args;
+};
+} // namespace Headless
+
+#endif
@@ -0,0 +1,268 @@
+#include "ArgumentParser.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fmt/core.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <sakura/AudioRingBuffer.hpp>
+#include <sakura/Emulator.hpp>
+#include <sakura/InputMovie.hpp>
+#include <sakura/Lockstep.hpp>
+
+void dump_frame_buffer(const std::filesystem::path &path,
+                       std::unique_ptr<Sakura::RendererInfo> &renderer_info) {
+  auto [width, height] = renderer_info->get_frame_buffer_dimensions();
+  auto frame_buffer_data = renderer_info->get_frame_buffer_data();
+  std::ofstream file = std::ofstream(path, std::ios::out | std::ios::binary);
+  file << fmt::format("P6\n{} {}\n255\n", width, height);
+  for (unsigned int i = 0; i < width * height * 3; i++) {
+    file.put(static_cast<char>(frame_buffer_data[i] * 255.0F));
+  }
+}
+
+void dump_vram(const std::filesystem::path &path,
+               std::unique_ptr<Sakura::RendererInfo> &renderer_info) {
+  const auto &vram = renderer_info->get_vram_data();
+  std::ofstream file = std::ofstream(path, std::ios::out | std::ios::binary);
+  for (uint16_t word : vram) {
+    file.put(static_cast<char>(word & 0xFF));
+    file.put(static_cast<char>(word >> 8));
+  }
+}
+
+void put_le(std::ofstream &file, uint32_t value, unsigned int bytes) {
+  for (unsigned int i = 0; i < bytes; i++) {
+    file.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+  }
+}
+
+void dump_audio(const std::filesystem::path &path,
+                const std::vector<int16_t> &samples) {
+  const uint32_t channels = 2;
+  const uint32_t bytes_per_sample = sizeof(int16_t);
+  uint32_t data_size = samples.size() * bytes_per_sample;
+  std::ofstream file = std::ofstream(path, std::ios::out | std::ios::binary);
+  file << "RIFF";
+  put_le(file, 36 + data_size, 4);
+  file << "WAVEfmt ";
+  put_le(file, 16, 4);
+  put_le(file, 1, 2);
+  put_le(file, channels, 2);
+  put_le(file, AUDIO_SAMPLE_RATE, 4);
+  put_le(file, AUDIO_SAMPLE_RATE * channels * bytes_per_sample, 4);
+  put_le(file, channels * bytes_per_sample, 2);
+  put_le(file, bytes_per_sample * 8, 2);
+  file << "data";
+  put_le(file, data_size, 4);
+  for (int16_t sample : samples) {
+    put_le(file, static_cast<uint16_t>(sample), 2);
+  }
+}
+
+auto read_state(const std::filesystem::path &path) -> std::vector<uint8_t> {
+  std::ifstream file = std::ifstream(path, std::ios::in | std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>());
+}
+
+void write_state(const std::filesystem::path &path,
+                 const std::vector<uint8_t> &state) {
+  std::ofstream file = std::ofstream(path, std::ios::out | std::ios::binary);
+  file.write(reinterpret_cast<const char *>(state.data()),
+             static_cast<std::streamsize>(state.size()));
+}
+
+auto main(int argc, char *argv[]) -> int {
+  Headless::Args args = Headless::ArgumentParser::parse(argc, argv);
+
+  Sakura::LogLevelConfig log_level_config = {
+      .disassembler = "critical",
+      .interrupt_controller = "critical",
+      .io = "critical",
+      .mapping_controller = "critical",
+      .processor = "critical",
+      .programmable_sound_generator = "critical",
+      .timer = "critical",
+      .video_color_encoder = "critical",
+      .video_display_controller = "critical",
+      .block_transfer_instruction = "critical",
+      .stack = "critical"};
+  Sakura::LogFormatterConfig log_formatter_config = {.enabled = true};
+  Sakura::VDCConfig vdc_config = {.deadbeef_vram = false};
+  Sakura::MOS6502ModeConfig mos_6502_mode_config = {.enabled = false};
+
+  Sakura::Emulator emulator =
+      Sakura::Emulator(vdc_config, mos_6502_mode_config);
+
+  // Drained once per frame, enough room for several frames of audio
+  const size_t audio_ring_buffer_capacity = 16384;
+  const size_t pc_sampler_capacity = 4096;
+  const size_t pc_sampler_report_length = 32;
+  const size_t call_profiler_max_depth = 256;
+  const size_t call_profiler_max_nodes = 65536;
+  const size_t call_profiler_report_length = 32;
+  // 16 MiB of records
+  const size_t trace_buffer_capacity = 1 << 20;
+  const uint64_t lockstep_block_cycles = 1024;
+  std::shared_ptr<Sakura::AudioRingBuffer> audio_ring_buffer;
+  std::vector<int16_t> audio_samples;
+  auto drain_audio = [&] {
+    size_t count = audio_ring_buffer->get_fill_level();
+    size_t offset = audio_samples.size();
+    audio_samples.resize(offset + count * 2);
+    audio_ring_buffer->read(&audio_samples[offset], count);
+  };
+  if (!args.audio.empty()) {
+    audio_ring_buffer =
+        std::make_shared<Sakura::AudioRingBuffer>(audio_ring_buffer_capacity);
+    emulator.attach_audio_ring_buffer(audio_ring_buffer);
+  }
+
+  std::shared_ptr<Sakura::InputMovie> movie;
+  if (!args.movie.empty()) {
+    movie = std::make_shared<Sakura::InputMovie>();
+    if (!movie->load(args.movie)) {
+      std::cout << "Unable to load input movie: " << args.movie << std::endl;
+      return 1;
+    }
+    emulator.attach_input_movie(movie, Sakura::InputMovieMode::Playback);
+  }
+  if (args.pc_sample_interval != 0) {
+    emulator.attach_pc_sampler(std::make_shared<Sakura::PCSampler>(
+        args.pc_sample_interval, pc_sampler_capacity));
+  }
+  std::shared_ptr<Sakura::CallProfiler> call_profiler;
+  if (!args.call_stacks.empty()) {
+    call_profiler = std::make_shared<Sakura::CallProfiler>(
+        call_profiler_max_depth, call_profiler_max_nodes);
+    emulator.attach_call_profiler(call_profiler);
+  }
+  if (!args.trace.empty()) {
+    auto trace_buffer = std::make_shared<Sakura::TraceBuffer>();
+    if (!trace_buffer->open(args.trace, trace_buffer_capacity)) {
+      std::cout << "Unable to open trace: " << args.trace << std::endl;
+      return 1;
+    }
+    emulator.attach_trace_buffer(trace_buffer);
+  }
+
+  uint64_t frames = 0;
+  emulator.set_vsync_callback(
+      [&](std::unique_ptr<Sakura::RendererInfo> & /*renderer_info*/) {
+        frames++;
+        if (audio_ring_buffer) {
+          drain_audio();
+        }
+        if (!args.lockstep && args.cycles == 0 && frames >= args.frames) {
+          emulator.set_should_pause();
+        }
+      });
+  emulator.initialize(args.rom, log_level_config, log_formatter_config);
+  if (!args.load_state.empty() &&
+      !emulator.load_state(read_state(args.load_state))) {
+    std::cout << "Unable to load save state: " << args.load_state
+              << std::endl;
+    return 1;
+  }
+  // Movies are keyed by emulated frame, which a loaded state may already be
+  // past some of
+  if (movie && args.frames == 0) {
+    uint64_t end = movie->get_length() + 1;
+    uint64_t start = std::min(end, emulator.get_frame());
+    args.frames = std::max<uint64_t>(end - start, 1);
+  }
+
+  // Only the execution engine differs between the two, today both use the
+  // interpreter
+  std::unique_ptr<Sakura::Emulator> candidate;
+  std::unique_ptr<Sakura::Lockstep> lockstep;
+  if (args.lockstep) {
+    candidate =
+        std::make_unique<Sakura::Emulator>(vdc_config, mos_6502_mode_config);
+    if (movie) {
+      candidate->attach_input_movie(movie, Sakura::InputMovieMode::Playback);
+    }
+    candidate->initialize(args.rom, log_level_config, log_formatter_config);
+    if (!args.load_state.empty() &&
+        !candidate->load_state(read_state(args.load_state))) {
+      std::cout << "Unable to load save state: " << args.load_state
+                << std::endl;
+      return 1;
+    }
+    lockstep = std::make_unique<Sakura::Lockstep>(
+        emulator, *candidate, *args.lockstep, lockstep_block_cycles);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  if (lockstep) {
+    while ((args.cycles != 0 ? emulator.get_executed_cycles() < args.cycles
+                             : frames < args.frames) &&
+           lockstep->step()) {
+    }
+  } else if (args.cycles != 0) {
+    emulator.emulate_cycles(args.cycles);
+  } else {
+    emulator.emulate();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  if (!args.frame_buffer.empty()) {
+    dump_frame_buffer(args.frame_buffer, emulator.get_renderer_info());
+  }
+  if (!args.vram.empty()) {
+    dump_vram(args.vram, emulator.get_renderer_info());
+  }
+  if (!args.save_state.empty()) {
+    std::vector<uint8_t> state;
+    emulator.save_state(state);
+    write_state(args.save_state, state);
+  }
+  if (audio_ring_buffer) {
+    drain_audio();
+    dump_audio(args.audio, audio_samples);
+  }
+  if (call_profiler) {
+    std::ofstream file = std::ofstream(args.call_stacks, std::ios::out);
+    file << call_profiler->get_folded_stacks();
+  }
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  uint64_t instructions = emulator.get_executed_instructions();
+  std::cout << fmt::format("Wall time: {:.3f} s", seconds) << std::endl;
+  std::cout << fmt::format("Frames: {} ({:.2f} frames/s)", frames,
+                           static_cast<double>(frames) / seconds)
+            << std::endl;
+  std::cout << fmt::format("Instructions: {} ({:.0f} instructions/s)",
+                           instructions,
+                           static_cast<double>(instructions) / seconds)
+            << std::endl;
+  std::cout << fmt::format("Cycles: {}", emulator.get_executed_cycles())
+            << std::endl;
+  if (audio_ring_buffer) {
+    std::cout << fmt::format("Audio: {} samples, {} dropped",
+                             audio_samples.size() / 2,
+                             audio_ring_buffer->get_overruns())
+              << std::endl;
+  }
+  if (Sakura::OpcodeProfiler::is_compiled_in()) {
+    std::cout << emulator.get_opcode_profiler()->get_report();
+  }
+  if (args.pc_sample_interval != 0) {
+    std::cout << emulator.get_pc_sampler_report(pc_sampler_report_length);
+  }
+  if (call_profiler) {
+    std::cout << call_profiler->get_report(call_profiler_report_length);
+  }
+  if (lockstep) {
+    if (!lockstep->get_report().empty()) {
+      std::cout << lockstep->get_report();
+      return 1;
+    }
+    std::cout << fmt::format("Lockstep: {} steps, no divergence",
+                             lockstep->get_steps())
+              << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include "Assembler.hpp"
+#include <fmt/core.h>
+#include <iostream>
+
+using namespace Sakura::Workloads;
+
+const size_t G_BANK_LENGTH = 0x2000;
+const uint16_t G_BANK_ADDRESS = 0xE000;
+// Vectors start at 0xFFF6, code can't run into them
+const uint16_t G_CODE_END = 0xFFF6;
+
+void FAIL(const std::string &message) {
+  std::cerr << message << std::endl;
+  exit(1); // NOLINT(concurrency-mt-unsafe)
+}
+
+Assembler::Assembler() : m_rom(G_BANK_LENGTH), m_address(G_BANK_ADDRESS) {}
+
+void Assembler::emit(uint8_t opcode) {
+  if (m_address >= G_CODE_END) {
+    FAIL(fmt::format("Code overflows into the vectors at: {:#06x}", m_address));
+  }
+  m_rom[m_address - G_BANK_ADDRESS] = opcode;
+  m_address++;
+}
+
+void Assembler::emit(uint8_t opcode, uint8_t operand) {
+  emit(opcode);
+  emit(operand);
+}
+
+void Assembler::emit_word(uint8_t opcode, uint16_t operand) {
+  emit(opcode);
+  emit(operand & 0xFF);
+  emit(operand >> 8);
+}
+
+void Assembler::emit_branch(uint8_t opcode, uint16_t target) {
+  int offset = target - (m_address + 2);
+  if (offset < -128 || offset > 127) {
+    FAIL(fmt::format("Branch from {:#06x} to {:#06x} is out of range",
+                     m_address, target));
+  }
+  emit(opcode, static_cast<uint8_t>(offset));
+}
+
+void Assembler::emit_block_transfer(uint8_t opcode, uint16_t source,
+                                    uint16_t destination, uint16_t length) {
+  emit(opcode);
+  for (uint16_t value : {source, destination, length}) {
+    emit(value & 0xFF);
+    emit(value >> 8);
+  }
+}
+
+void Assembler::set_vector(uint16_t vector, uint16_t target) {
+  m_rom[vector - G_BANK_ADDRESS] = target & 0xFF;
+  m_rom[vector - G_BANK_ADDRESS + 1] = target >> 8;
+}
+
+auto Assembler::add_bank(const std::vector<uint8_t> &data) -> uint8_t {
+  if (data.size() > G_BANK_LENGTH) {
+    FAIL(fmt::format("Data of size {:#X} doesn't fit in a bank", data.size()));
+  }
+  auto bank = static_cast<uint8_t>(m_rom.size() / G_BANK_LENGTH);
+  m_rom.insert(m_rom.end(), data.begin(), data.end());
+  m_rom.resize(m_rom.size() + G_BANK_LENGTH - data.size());
+  return bank;
+}
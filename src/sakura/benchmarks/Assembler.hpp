@@ -0,0 +1,94 @@
+#ifndef SAKURA_ASSEMBLER_HPP
+#define SAKURA_ASSEMBLER_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace Sakura::Workloads {
+
+// Only the opcodes the workloads use
+enum Opcode : uint8_t {
+  ST0 = 0x03,
+  ORA_IMM = 0x09,
+  ASL_ACC = 0x0A,
+  ST1 = 0x13,
+  CLC = 0x18,
+  ST2 = 0x23,
+  AND_IMM = 0x29,
+  ROL_ACC = 0x2A,
+  RTI = 0x40,
+  EOR_ZP = 0x45,
+  PHA = 0x48,
+  EOR_IMM = 0x49,
+  JMP_ABS = 0x4C,
+  TAM_I = 0x53,
+  CLI = 0x58,
+  CLA = 0x62,
+  STZ_ZP = 0x64,
+  PLA = 0x68,
+  ADC_IMM = 0x69,
+  ADC_ZP_X = 0x75,
+  SEI = 0x78,
+  BRA = 0x80,
+  STA_ZP = 0x85,
+  DEY = 0x88,
+  TXA = 0x8A,
+  STA_ABS = 0x8D,
+  STA_ZP_X = 0x95,
+  TXS = 0x9A,
+  STA_ABS_X = 0x9D,
+  LDY_IMM = 0xA0,
+  LDX_IMM = 0xA2,
+  LDA_ZP = 0xA5,
+  LDA_IMM = 0xA9,
+  TAX = 0xAA,
+  LDA_ABS = 0xAD,
+  LDA_ZP_X = 0xB5,
+  DEC_ZP = 0xC6,
+  CMP_IMM = 0xC9,
+  DEX = 0xCA,
+  BNE = 0xD0,
+  CSH = 0xD4,
+  CLD = 0xD8,
+  TIA = 0xE3,
+  INC_ZP = 0xE6,
+  INX = 0xE8,
+  SBC_IMM = 0xE9,
+  BEQ = 0xF0,
+};
+
+/*
+Assembles code into the first 8 KiB bank of a ROM image. The bank is mapped at
+0xE000 on reset, so code is addressed from there and the interrupt vectors
+live at the end of the bank. Labels are plain addresses taken with here(),
+which is enough for the backward branches and handlers the workloads need.
+Data is appended in banks of its own, that the code maps before using.
+*/
+class Assembler {
+private:
+  std::vector<uint8_t> m_rom;
+  uint16_t m_address;
+
+public:
+  Assembler();
+  ~Assembler() = default;
+
+  [[nodiscard]] auto here() const -> uint16_t { return m_address; }
+
+  void emit(uint8_t opcode);
+  void emit(uint8_t opcode, uint8_t operand);
+  void emit_word(uint8_t opcode, uint16_t operand);
+  void emit_branch(uint8_t opcode, uint16_t target);
+  void emit_block_transfer(uint8_t opcode, uint16_t source,
+                           uint16_t destination, uint16_t length);
+  void set_vector(uint16_t vector, uint16_t target);
+  // Returns the bank the data was placed in
+  auto add_bank(const std::vector<uint8_t> &data) -> uint8_t;
+
+  [[nodiscard]] auto get_rom() const -> const std::vector<uint8_t> & {
+    return m_rom;
+  }
+};
+}; // namespace Sakura::Workloads
+
+#endif
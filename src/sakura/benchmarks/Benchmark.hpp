@@ -0,0 +1,106 @@
+#ifndef SAKURA_BENCHMARK_HPP
+#define SAKURA_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fmt/core.h>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Sakura::Benchmarks {
+
+struct BenchmarkResult {
+  std::string name;
+  // Operations timed in the fastest batch, iterations * operations_per_call
+  uint64_t operations;
+  double nanoseconds_per_operation;
+};
+
+// Keeps the compiler from dropping work whose result is never used
+template <typename T> void DO_NOT_OPTIMIZE(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/*
+Runs a body that performs operations_per_call operations, first doubling the
+iterations until one batch takes long enough to time reliably, then keeping
+the fastest of a few batches so scheduler noise doesn't leak into results.
+*/
+class Benchmark {
+private:
+  using Clock = std::chrono::steady_clock;
+
+  std::string m_filter;
+  std::vector<BenchmarkResult> m_results;
+
+public:
+  explicit Benchmark(std::string filter) : m_filter(std::move(filter)) {}
+  ~Benchmark() = default;
+
+  template <typename F>
+  void run(const std::string &name, uint64_t operations_per_call, F &&body) {
+    if (name.find(m_filter) == std::string::npos) {
+      return;
+    }
+    const Clock::duration min_batch = std::chrono::milliseconds(20);
+    const unsigned int batches = 5;
+
+    uint64_t iterations = 1;
+    for (;;) {
+      auto start = Clock::now();
+      for (uint64_t i = 0; i < iterations; i++) {
+        body();
+      }
+      if (Clock::now() - start >= min_batch ||
+          iterations >= std::numeric_limits<uint64_t>::max() / 2) {
+        break;
+      }
+      iterations *= 2;
+    }
+    double best = std::numeric_limits<double>::max();
+    for (unsigned int batch = 0; batch < batches; batch++) {
+      auto start = Clock::now();
+      for (uint64_t i = 0; i < iterations; i++) {
+        body();
+      }
+      std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+      best = std::min(best, elapsed.count());
+    }
+    uint64_t operations = iterations * operations_per_call;
+    m_results.push_back(
+        {name, operations, best / static_cast<double>(operations)});
+  }
+
+  [[nodiscard]] auto get_results() const
+      -> const std::vector<BenchmarkResult> & {
+    return m_results;
+  }
+
+  [[nodiscard]] auto to_csv() const -> std::string {
+    std::string csv = "name,operations,ns_per_op\n";
+    for (const auto &result : m_results) {
+      csv += fmt::format("{},{},{:.3f}\n", result.name, result.operations,
+                         result.nanoseconds_per_operation);
+    }
+    return csv;
+  }
+
+  [[nodiscard]] auto to_json() const -> std::string {
+    std::string json = "[\n";
+    for (size_t i = 0; i < m_results.size(); i++) {
+      const auto &result = m_results[i];
+      json += fmt::format("  {{\"name\": \"{}\", \"operations\": {}, "
+                          "\"ns_per_op\": {:.3f}}}{}\n",
+                          result.name, result.operations,
+                          result.nanoseconds_per_operation,
+                          i + 1 < m_results.size() ? "," : "");
+    }
+    return json + "]\n";
+  }
+};
+}; // namespace Sakura::Benchmarks
+
+#endif
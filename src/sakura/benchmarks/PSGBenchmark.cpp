@@ -0,0 +1,83 @@
+#include "ProgrammableSoundGenerator.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fmt/core.h>
+#include <iostream>
+#include <sakura/Constants.hpp>
+
+using namespace Sakura::HuC6280::ProgrammableSoundGenerator;
+
+const uint64_t G_SECONDS = 60;
+const uint64_t G_CYCLES_PER_FRAME = CYCLES_PER_SECOND / 60;
+// Average instruction length, the PSG is stepped once per instruction
+const uint8_t G_CYCLES_PER_INSTRUCTION = 4;
+
+void select_channel(Controller &psg, uint8_t channel) { psg.store(0, channel); }
+
+void set_frequency(Controller &psg, uint16_t frequency) {
+  psg.store(2, frequency & 0xFF);
+  psg.store(3, frequency >> 8);
+}
+
+// Four waveform channels, the LFO on the first pair and noise on the last two
+void setup(Controller &psg) {
+  psg.store(1, 0xFF);
+  for (uint8_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+    select_channel(psg, channel);
+    psg.store(4, 0x00);
+    for (unsigned int i = 0; i < WAVEFORM_LENGTH; i++) {
+      psg.store(6, (i * (channel + 1)) & 0x1F);
+    }
+    set_frequency(psg, 0x80 + channel * 0x60);
+    psg.store(5, 0xFF);
+    psg.store(7, channel >= 4 ? 0x80 | (channel * 7) : 0x00);
+    psg.store(4, 0x9F);
+  }
+  psg.store(8, 0x10);
+  psg.store(9, 0x01);
+}
+
+// Sound drivers usually update every channel once per frame
+void update(Controller &psg, uint64_t frame) {
+  for (uint8_t channel = 0; channel < NUMBER_OF_CHANNELS; channel++) {
+    select_channel(psg, channel);
+    set_frequency(psg, 0x80 + ((frame * 7 + channel * 0x60) & 0x3FF));
+    psg.store(4, 0x80 | (0x10 + ((frame + channel) & 0x0F)));
+  }
+}
+
+auto main(int argc, char *argv[]) -> int {
+  unsigned int sample_rate = AUDIO_SAMPLE_RATE;
+  if (argc > 1) {
+    sample_rate = std::strtoul(argv[1], nullptr, 10);
+  }
+
+  Controller psg = Controller();
+  psg.set_sample_rate(sample_rate);
+  uint64_t samples = 0;
+  psg.set_audio_callback([&](const std::vector<float> &block) {
+    samples += block.size() / 2;
+  });
+  setup(psg);
+
+  auto start = std::chrono::steady_clock::now();
+  uint64_t frames = G_SECONDS * CYCLES_PER_SECOND / G_CYCLES_PER_FRAME;
+  for (uint64_t frame = 0; frame < frames; frame++) {
+    update(psg, frame);
+    for (uint64_t cycles = 0; cycles < G_CYCLES_PER_FRAME;
+         cycles += G_CYCLES_PER_INSTRUCTION) {
+      psg.step(G_CYCLES_PER_INSTRUCTION);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << fmt::format("Emulated: {} s at {} Hz", G_SECONDS, sample_rate)
+            << std::endl;
+  std::cout << fmt::format("Samples: {}", samples) << std::endl;
+  std::cout << fmt::format("Wall time: {:.3f} s", seconds) << std::endl;
+  std::cout << fmt::format("Realtime factor: {:.1f}x",
+                           static_cast<double>(G_SECONDS) / seconds)
+            << std::endl;
+  return 0;
+}
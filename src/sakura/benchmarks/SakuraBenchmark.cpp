@@ -0,0 +1,180 @@
+#include "Benchmark.hpp"
+#include "Instructions.hpp"
+#include "Machine.hpp"
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sakura/Emulator.hpp>
+#include <sakura/RendererInfo.hpp>
+#include <spdlog/spdlog.h>
+
+using namespace Sakura;
+using namespace Sakura::Benchmarks;
+
+// Enough operations per call to hide the cost of the benchmark loop
+const unsigned int G_OPERATIONS_PER_CALL = 256;
+const uint8_t G_RAM_BANK = 0xF8;
+const uint8_t G_HARDWARE_BANK = 0xFF;
+const uint8_t G_UNUSED_BANK = 0x80;
+const uint16_t G_IO_ADDRESS = 0x1000;
+// Operands shared by every instruction: zero page 0x02, absolute 0x0002,
+// block transfers of one byte from 0x0002 to 0x0000
+const uint16_t G_OPERANDS_ADDRESS = 0x5000;
+const std::array<uint8_t, 6> G_OPERANDS = {0x02, 0x00, 0x00, 0x00, 0x01, 0x00};
+const uint8_t G_TXS_OPCODE = 0x9A;
+
+void benchmark_mapping(Benchmark &benchmark, Machine &machine) {
+  auto &mapping = machine.mapping_controller;
+  auto bench_load = [&](const std::string &name, uint8_t bank,
+                        uint16_t base) {
+    machine.map_all(bank);
+    benchmark.run(name, G_OPERATIONS_PER_CALL, [&] {
+      uint8_t sum = 0;
+      for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+        sum += mapping->load(base + (i & 0xFF));
+      }
+      DO_NOT_OPTIMIZE(sum);
+    });
+  };
+  bench_load("mapping.load.rom", 0x00, 0x0000);
+  bench_load("mapping.load.ram", G_RAM_BANK, 0x0000);
+  bench_load("mapping.load.unused", G_UNUSED_BANK, 0x0000);
+  bench_load("mapping.load.io", G_HARDWARE_BANK, G_IO_ADDRESS);
+
+  machine.map_all(G_RAM_BANK);
+  benchmark.run("mapping.store.ram", G_OPERATIONS_PER_CALL, [&] {
+    for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+      mapping->store(i & 0xFF, i);
+    }
+  });
+  machine.map_all(G_HARDWARE_BANK);
+  benchmark.run("mapping.store.io", G_OPERATIONS_PER_CALL, [&] {
+    for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+      mapping->store(G_IO_ADDRESS, i & 0b11);
+    }
+  });
+  benchmark.run("mapping.store.vdc", G_OPERATIONS_PER_CALL, [&] {
+    for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+      mapping->store(0x0000, 0x00);
+    }
+  });
+}
+
+void benchmark_instructions(Benchmark &benchmark, Machine &machine) {
+  auto &processor = machine.processor;
+  machine.map_all(G_RAM_BANK);
+  for (size_t i = 0; i < G_OPERANDS.size(); i++) {
+    machine.mapping_controller->store(G_OPERANDS_ADDRESS + i, G_OPERANDS[i]);
+  }
+  HuC6280::Registers registers = HuC6280::Registers();
+  registers.x = 0xFF;
+  processor->set_registers(registers);
+  HuC6280::INTERPRETER_TABLE[G_TXS_OPCODE](processor, G_TXS_OPCODE);
+
+  // Restored before every instruction so branches, stack operations and
+  // flag changes don't carry over
+  registers.accumulator = G_RAM_BANK;
+  registers.x = 0;
+  registers.program_counter.value = G_OPERANDS_ADDRESS;
+  registers.stack_pointer = 0xFF;
+  registers.status.interrupt_disable = 1;
+  for (unsigned int opcode = 0; opcode < 0x100; opcode++) {
+    auto handler = HuC6280::INTERPRETER_TABLE[opcode];
+    if (handler == nullptr) {
+      continue;
+    }
+    benchmark.run(fmt::format("instruction.{:#04x}", opcode), 1, [&] {
+      processor->set_registers(registers);
+      DO_NOT_OPTIMIZE(handler(processor, opcode));
+    });
+  }
+}
+
+void benchmark_timer(Benchmark &benchmark, Machine &machine) {
+  HuC6280::Timer::Controller timer =
+      HuC6280::Timer::Controller(machine.interrupt_controller);
+  timer.store(0, 0x7F);
+  timer.store(1, 0x01);
+  benchmark.run("timer.step", G_OPERATIONS_PER_CALL, [&] {
+    for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+      timer.step(4);
+    }
+  });
+}
+
+void benchmark_video(Benchmark &benchmark, Machine &machine) {
+  auto &vdc = machine.video_display_controller;
+  benchmark.run("vdc.store.register_select", G_OPERATIONS_PER_CALL, [&] {
+    for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+      vdc->store(0, 0x00);
+    }
+  });
+  // MAWR to 0 and VWR selected, every operation writes one word
+  vdc->store(0, 0x00);
+  vdc->store(2, 0x00);
+  vdc->store(3, 0x00);
+  vdc->store(0, 0x02);
+  benchmark.run("vdc.store.vram_word", G_OPERATIONS_PER_CALL, [&] {
+    for (unsigned int i = 0; i < G_OPERATIONS_PER_CALL; i++) {
+      vdc->store(2, i * 37);
+      vdc->store(3, i * 11);
+    }
+  });
+
+  auto &renderer_info = machine.renderer_info;
+  // Decodes every character, timed per character
+  benchmark.run("vdc.decode_character",
+                CHARACTER_GENERATOR_NUMBER_OF_CHARACTERS, [&] {
+                  DO_NOT_OPTIMIZE(
+                      renderer_info->get_character_generator_data()[0]);
+                });
+  benchmark.run("renderer_info.frame_buffer", 1, [&] {
+    DO_NOT_OPTIMIZE(renderer_info->get_frame_buffer_data()[0]);
+  });
+  benchmark.run("renderer_info.color_table", 1, [&] {
+    DO_NOT_OPTIMIZE(renderer_info->get_color_table_data()[0]);
+  });
+  std::vector<DirtyRectangle> dirty_rectangles;
+  benchmark.run("renderer_info.background_attribute_table", 1, [&] {
+    DO_NOT_OPTIMIZE(renderer_info->get_background_attribute_table_data(
+        dirty_rectangles)[0]);
+  });
+}
+
+void print_usage() {
+  std::cout << "Usage: sakura-bench [-h] [-j] [filter]" << std::endl;
+  std::cout << "" << std::endl;
+  std::cout << "  -h   print this message" << std::endl;
+  std::cout << "  -j   print JSON instead of CSV" << std::endl;
+  std::cout << "  only benchmarks whose name contains filter are run"
+            << std::endl;
+  std::cout << "" << std::endl;
+}
+
+auto main(int argc, char *argv[]) -> int {
+  bool json = false;
+  std::string filter;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "-h") == 0) {
+      print_usage();
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-j") == 0) {
+      json = true;
+    } else {
+      filter = argv[i];
+    }
+  }
+
+  Machine::register_null_loggers();
+  Benchmark benchmark = Benchmark(filter);
+  Machine machine = Machine();
+  benchmark_mapping(benchmark, machine);
+  benchmark_instructions(benchmark, machine);
+  benchmark_timer(benchmark, machine);
+  benchmark_video(benchmark, machine);
+
+  std::cout << (json ? benchmark.to_json() : benchmark.to_csv());
+  return 0;
+}
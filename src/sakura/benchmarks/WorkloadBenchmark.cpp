@@ -0,0 +1,128 @@
+#include "Workloads.hpp"
+#include <chrono>
+#include <cstring>
+#include <fmt/core.h>
+#include <iostream>
+#include <sakura/Constants.hpp>
+#include <sakura/Emulator.hpp>
+#include <string>
+
+using namespace Sakura::Workloads;
+
+const uint64_t G_DEFAULT_SECONDS = 10;
+
+struct WorkloadResult {
+  std::string name;
+  uint64_t cycles;
+  uint64_t instructions;
+  uint64_t frames;
+  double host_seconds;
+};
+
+auto run(const Workload &workload, uint64_t seconds) -> WorkloadResult {
+  Sakura::LogLevelConfig log_level_config = {
+      .disassembler = "off",
+      .interrupt_controller = "off",
+      .io = "off",
+      .mapping_controller = "off",
+      .processor = "off",
+      .programmable_sound_generator = "off",
+      .timer = "off",
+      .video_color_encoder = "off",
+      .video_display_controller = "off",
+      .block_transfer_instruction = "off",
+      .stack = "off"};
+  Sakura::LogFormatterConfig log_formatter_config = {.enabled = false};
+  Sakura::Emulator emulator = Sakura::Emulator(
+      {.deadbeef_vram = false}, {.enabled = false});
+  emulator.initialize(workload.rom, log_level_config, log_formatter_config);
+
+  auto start = std::chrono::steady_clock::now();
+  emulator.emulate_cycles(seconds * CYCLES_PER_SECOND);
+  auto end = std::chrono::steady_clock::now();
+  return {.name = workload.name,
+          .cycles = emulator.get_executed_cycles(),
+          .instructions = emulator.get_executed_instructions(),
+          .frames = emulator.get_frame(),
+          .host_seconds = std::chrono::duration<double>(end - start).count()};
+}
+
+auto cycles_per_second(const WorkloadResult &result) -> double {
+  return static_cast<double>(result.cycles) / result.host_seconds;
+}
+
+auto to_csv(const std::vector<WorkloadResult> &results) -> std::string {
+  std::string csv = "name,cycles,instructions,frames,host_seconds,"
+                    "cycles_per_second,realtime_factor\n";
+  for (const auto &result : results) {
+    csv += fmt::format("{},{},{},{},{:.3f},{:.0f},{:.2f}\n", result.name,
+                       result.cycles, result.instructions, result.frames,
+                       result.host_seconds, cycles_per_second(result),
+                       cycles_per_second(result) / CYCLES_PER_SECOND);
+  }
+  return csv;
+}
+
+auto to_json(const std::vector<WorkloadResult> &results) -> std::string {
+  std::string json = "[\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    const auto &result = results[i];
+    json += fmt::format(
+        "  {{\"name\": \"{}\", \"cycles\": {}, \"instructions\": {}, "
+        "\"frames\": {}, \"host_seconds\": {:.3f}, "
+        "\"cycles_per_second\": {:.0f}, \"realtime_factor\": {:.2f}}}{}\n",
+        result.name, result.cycles, result.instructions, result.frames,
+        result.host_seconds, cycles_per_second(result),
+        cycles_per_second(result) / CYCLES_PER_SECOND,
+        i + 1 < results.size() ? "," : "");
+  }
+  return json + "]\n";
+}
+
+void print_usage() {
+  std::cout << "Usage: sakura-workload-bench [-h] [-j] [-s seconds] [filter]"
+            << std::endl;
+  std::cout << "" << std::endl;
+  std::cout << "  -h   print this message" << std::endl;
+  std::cout << "  -j   print JSON instead of CSV" << std::endl;
+  std::cout << "  -s   emulated seconds per workload (default: "
+            << G_DEFAULT_SECONDS << ")" << std::endl;
+  std::cout << "  only workloads whose name contains filter are run"
+            << std::endl;
+  std::cout << "" << std::endl;
+  std::cout << "Workloads:" << std::endl;
+  for (const auto &workload : GENERATE_WORKLOADS()) {
+    std::cout << fmt::format("  {:<12} {}", workload.name,
+                             workload.description)
+              << std::endl;
+  }
+}
+
+auto main(int argc, char *argv[]) -> int {
+  bool json = false;
+  uint64_t seconds = G_DEFAULT_SECONDS;
+  std::string filter;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "-h") == 0) {
+      print_usage();
+      return 0;
+    }
+    if (std::strcmp(argv[i], "-j") == 0) {
+      json = true;
+    } else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      seconds = std::stoul(argv[++i]);
+    } else {
+      filter = argv[i];
+    }
+  }
+
+  std::vector<WorkloadResult> results;
+  for (const auto &workload : GENERATE_WORKLOADS()) {
+    if (workload.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    results.push_back(run(workload, seconds));
+  }
+  std::cout << (json ? to_json(results) : to_csv(results));
+  return 0;
+}
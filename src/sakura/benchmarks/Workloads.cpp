@@ -0,0 +1,392 @@
+#include "Workloads.hpp"
+#include "Assembler.hpp"
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Sakura::Workloads;
+
+// Logical addresses once the prologue maps the hardware page to MPR0 and the
+// first RAM bank to MPR1
+const uint16_t G_VDC_DATA_LOW = 0x0002;
+const uint16_t G_VDC_DATA_HIGH = 0x0003;
+const uint16_t G_VCE_COLOR_TABLE_DATA_LOW = 0x0404;
+const uint16_t G_VCE_COLOR_TABLE_DATA_HIGH = 0x0405;
+const uint16_t G_TIMER_RELOAD = 0x0C00;
+const uint16_t G_TIMER_CONTROL = 0x0C01;
+const uint16_t G_INTERRUPT_DISABLE = 0x1402;
+const uint16_t G_INTERRUPT_REQUEST = 0x1403;
+const uint16_t G_VDC_STATUS = 0x0000;
+const uint16_t G_UPLOAD_SOURCE = 0x2200;
+const uint16_t G_UPLOAD_LENGTH = 0x200;
+const uint32_t G_VRAM_LENGTH = 0x10000;
+// Short enough for the cycle count of a single transfer to fit in a byte
+const uint16_t G_UPLOAD_CHUNK = 0x20;
+
+const uint16_t G_VECTOR_INTERRUPT_REQUEST_2 = 0xFFF6;
+const uint16_t G_VECTOR_INTERRUPT_REQUEST_1 = 0xFFF8;
+const uint16_t G_VECTOR_TIMER = 0xFFFA;
+const uint16_t G_VECTOR_NONMASKABLE_INTERRUPT = 0xFFFC;
+const uint16_t G_VECTOR_RESET = 0xFFFE;
+
+const uint8_t G_VDC_MAWR = 0x00;
+const uint8_t G_VDC_VWR = 0x02;
+const uint8_t G_VDC_CR = 0x05;
+const uint8_t G_VDC_BXR = 0x07;
+const uint8_t G_VDC_DVSSR = 0x13;
+// Background and sprites enabled
+const uint16_t G_CONTROL_DISPLAY = 0x00C0;
+const uint16_t G_CONTROL_VBLANK_IRQ = 0x0008;
+// 256x240 display with a 32x32 background attribute table
+const std::array<std::pair<uint8_t, uint16_t>, 6> G_DISPLAY_REGISTERS = {{
+    {0x09, 0x0000},
+    {0x0A, 0x0202},
+    {0x0B, 0x041F},
+    {0x0C, 0x0F02},
+    {0x0D, 0x00EF},
+    {0x0E, 0x0003},
+}};
+
+// Where the scene lives in VRAM. Sprites are kept below the characters, which
+// are the start of the area the VRAM upload workload writes to
+const uint16_t G_VRAM_BACKGROUND_ATTRIBUTE_TABLE = 0x0000;
+const uint16_t G_VRAM_SPRITE_PATTERNS = 0x0400;
+const uint16_t G_VRAM_SPRITE_ATTRIBUTE_TABLE = 0x0500;
+const uint16_t G_VRAM_CHARACTERS = 0x1000;
+const unsigned int G_BACKGROUND_ATTRIBUTE_TABLE_LENGTH = 32 * 32;
+const unsigned int G_CHARACTER_WORDS = 16;
+const unsigned int G_SCENE_CHARACTERS = 16;
+const unsigned int G_SPRITE_PATTERN_WORDS = 64;
+const unsigned int G_SCENE_SPRITE_PATTERNS = 4;
+const unsigned int G_SPRITE_ATTRIBUTE_TABLE_LENGTH = 64 * 4;
+const unsigned int G_SCENE_SPRITES = 16;
+const uint16_t G_SPRITE_PRIORITY = 0x0080;
+// The scene data bank is mapped to MPR3 while it is uploaded
+const uint8_t G_SCENE_MAPPING_REGISTER = 0x08;
+const uint16_t G_SCENE_ADDRESS = 0x6000;
+
+// Zero page variables
+const uint8_t G_VBLANK_FLAG = 0x00;
+const uint8_t G_COUNTER = 0x01;
+const uint8_t G_SCROLL = 0x02;
+
+void EMIT_VDC_REGISTER(Assembler &assembler, uint8_t index, uint16_t value) {
+  assembler.emit(ST0, index);
+  assembler.emit(ST1, value & 0xFF);
+  assembler.emit(ST2, value >> 8);
+}
+
+// xorshift32, the scenes only need to be different from each other and the
+// same on every run
+auto NEXT_SCENE_VALUE(uint32_t &state) -> uint32_t {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+struct SceneUpload {
+  uint16_t vram_address;
+  std::vector<uint16_t> words;
+};
+
+// Characters of random dots, each position of the background attribute table
+// picks one of them and a palette
+auto GENERATE_BACKGROUND(uint32_t &state) -> std::vector<SceneUpload> {
+  std::vector<uint16_t> characters(G_SCENE_CHARACTERS * G_CHARACTER_WORDS);
+  for (auto &word : characters) {
+    word = NEXT_SCENE_VALUE(state) & 0xFFFF;
+  }
+  std::vector<uint16_t> table(G_BACKGROUND_ATTRIBUTE_TABLE_LENGTH);
+  for (auto &entry : table) {
+    uint32_t value = NEXT_SCENE_VALUE(state);
+    entry = ((value & 0xF) << 12) |
+            ((G_VRAM_CHARACTERS / G_CHARACTER_WORDS) +
+             ((value >> 4) % G_SCENE_CHARACTERS));
+  }
+  return {{G_VRAM_CHARACTERS, characters},
+          {G_VRAM_BACKGROUND_ATTRIBUTE_TABLE, table}};
+}
+
+// 16x16 discs of rings in random colors, drawn in front of the background at
+// random positions of the display
+auto GENERATE_SPRITES(uint32_t &state) -> std::vector<SceneUpload> {
+  std::vector<uint16_t> patterns(G_SCENE_SPRITE_PATTERNS *
+                                 G_SPRITE_PATTERN_WORDS);
+  for (unsigned int pattern = 0; pattern < G_SCENE_SPRITE_PATTERNS;
+       pattern++) {
+    std::array<uint8_t, 8> ring_colors = {};
+    for (auto &color : ring_colors) {
+      color = 1 + (NEXT_SCENE_VALUE(state) % 15);
+    }
+    for (int y = 0; y < 16; y++) {
+      for (int x = 0; x < 16; x++) {
+        int dx = 2 * x - 15;
+        int dy = 2 * y - 15;
+        int distance = dx * dx + dy * dy;
+        if (distance > 225) {
+          continue;
+        }
+        uint8_t color = ring_colors[distance * 8 / 226];
+        for (unsigned int plane = 0; plane < 4; plane++) {
+          if (((color >> plane) & 0b1) != 0) {
+            patterns[pattern * G_SPRITE_PATTERN_WORDS + plane * 16 + y] |=
+                0x8000 >> x;
+          }
+        }
+      }
+    }
+  }
+  // The sprites that aren't used stay above the display
+  std::vector<uint16_t> table(G_SPRITE_ATTRIBUTE_TABLE_LENGTH);
+  for (unsigned int sprite = 0; sprite < G_SCENE_SPRITES; sprite++) {
+    uint32_t value = NEXT_SCENE_VALUE(state);
+    uint16_t pattern_code = (G_VRAM_SPRITE_PATTERNS / G_SPRITE_PATTERN_WORDS) +
+                            (value % G_SCENE_SPRITE_PATTERNS);
+    table[sprite * 4] = 64 + ((value >> 2) % 224);
+    table[sprite * 4 + 1] = 32 + ((value >> 10) % 240);
+    table[sprite * 4 + 2] = pattern_code << 1;
+    table[sprite * 4 + 3] = G_SPRITE_PRIORITY | ((value >> 20) & 0xF);
+  }
+  return {{G_VRAM_SPRITE_PATTERNS, patterns},
+          {G_VRAM_SPRITE_ATTRIBUTE_TABLE, table}};
+}
+
+// Uploads the scene from a data bank with TIA, like games upload their
+// graphics, and has the sprite attribute table copied on the next vertical
+// blank
+void EMIT_SCENE(Assembler &assembler, const std::string &scene) {
+  // FNV-1a of the name seeds the generator, which must not start at zero
+  uint32_t state = 2166136261U;
+  for (char c : scene) {
+    state = (state ^ static_cast<uint8_t>(c)) * 16777619U;
+  }
+  std::vector<SceneUpload> uploads = GENERATE_BACKGROUND(state);
+  for (auto &upload : GENERATE_SPRITES(state)) {
+    uploads.push_back(std::move(upload));
+  }
+  std::vector<uint8_t> data;
+  std::vector<uint16_t> offsets;
+  for (const auto &upload : uploads) {
+    offsets.push_back(data.size());
+    for (uint16_t word : upload.words) {
+      data.push_back(word & 0xFF);
+      data.push_back(word >> 8);
+    }
+  }
+  uint8_t bank = assembler.add_bank(data);
+
+  assembler.emit(LDA_IMM, bank);
+  assembler.emit(TAM_I, G_SCENE_MAPPING_REGISTER);
+  for (size_t i = 0; i < uploads.size(); i++) {
+    EMIT_VDC_REGISTER(assembler, G_VDC_MAWR, uploads[i].vram_address);
+    assembler.emit(ST0, G_VDC_VWR);
+    uint16_t length = uploads[i].words.size() * 2;
+    for (uint16_t offset = 0; offset < length; offset += G_UPLOAD_CHUNK) {
+      assembler.emit_block_transfer(TIA, G_SCENE_ADDRESS + offsets[i] + offset,
+                                    G_VDC_DATA_LOW, G_UPLOAD_CHUNK);
+    }
+  }
+  EMIT_VDC_REGISTER(assembler, G_VDC_DVSSR, G_VRAM_SPRITE_ATTRIBUTE_TABLE);
+}
+
+// Reset state every workload starts from, interrupts stay disabled. Scenes
+// are generated from the workload name, so every workload renders frames of
+// its own
+void EMIT_PROLOGUE(Assembler &assembler, uint16_t control,
+                   const std::string &scene) {
+  assembler.set_vector(G_VECTOR_RESET, assembler.here());
+  assembler.emit(SEI);
+  assembler.emit(CSH);
+  assembler.emit(CLD);
+  assembler.emit(LDX_IMM, 0xFF);
+  assembler.emit(TXS);
+  assembler.emit(LDA_IMM, 0xFF);
+  assembler.emit(TAM_I, 0x01);
+  assembler.emit(LDA_IMM, 0xF8);
+  assembler.emit(TAM_I, 0x02);
+  assembler.emit(CLA);
+  assembler.emit_word(STA_ABS, G_INTERRUPT_DISABLE);
+
+  for (const auto &[index, value] : G_DISPLAY_REGISTERS) {
+    EMIT_VDC_REGISTER(assembler, index, value);
+  }
+  EMIT_VDC_REGISTER(assembler, G_VDC_CR, control);
+
+  // The first 256 colors for the background and their complements for the
+  // sprites, the color table address starts at 0
+  for (uint8_t mask : {0x00, 0xFF}) {
+    assembler.emit(LDX_IMM, 0x00);
+    uint16_t palette = assembler.here();
+    assembler.emit(TXA);
+    assembler.emit(EOR_IMM, mask);
+    assembler.emit_word(STA_ABS, G_VCE_COLOR_TABLE_DATA_LOW);
+    assembler.emit(AND_IMM, 0x01);
+    assembler.emit_word(STA_ABS, G_VCE_COLOR_TABLE_DATA_HIGH);
+    assembler.emit(INX);
+    assembler.emit_branch(BNE, palette);
+  }
+  EMIT_SCENE(assembler, scene);
+}
+
+// Vectors nothing should trigger return straight away
+void EMIT_DEFAULT_VECTORS(Assembler &assembler) {
+  uint16_t handler = assembler.here();
+  assembler.emit(RTI);
+  for (uint16_t vector :
+       {G_VECTOR_INTERRUPT_REQUEST_2, G_VECTOR_INTERRUPT_REQUEST_1,
+        G_VECTOR_TIMER, G_VECTOR_NONMASKABLE_INTERRUPT}) {
+    assembler.set_vector(vector, handler);
+  }
+}
+
+// 255 iterations of accumulator arithmetic and logic with no memory traffic
+void EMIT_ALU_LOOP(Assembler &assembler) {
+  assembler.emit(LDY_IMM, 0xFF);
+  uint16_t loop = assembler.here();
+  assembler.emit(TXA);
+  assembler.emit(CLC);
+  assembler.emit(ADC_IMM, 0x13);
+  assembler.emit(EOR_IMM, 0x5A);
+  assembler.emit(ASL_ACC);
+  assembler.emit(ROL_ACC);
+  assembler.emit(AND_IMM, 0xF7);
+  assembler.emit(ORA_IMM, 0x21);
+  assembler.emit(SBC_IMM, 0x07);
+  assembler.emit(CMP_IMM, 0x80);
+  assembler.emit(TAX);
+  assembler.emit(DEY);
+  assembler.emit_branch(BNE, loop);
+}
+
+auto ALU() -> Workload {
+  Assembler assembler = Assembler();
+  EMIT_DEFAULT_VECTORS(assembler);
+  EMIT_PROLOGUE(assembler, G_CONTROL_DISPLAY, "alu");
+  uint16_t loop = assembler.here();
+  EMIT_ALU_LOOP(assembler);
+  assembler.emit_branch(BRA, loop);
+  return {.name = "alu",
+          .description = "Register arithmetic and logic loops",
+          .rom = assembler.get_rom()};
+}
+
+auto ZERO_PAGE() -> Workload {
+  Assembler assembler = Assembler();
+  EMIT_DEFAULT_VECTORS(assembler);
+  EMIT_PROLOGUE(assembler, G_CONTROL_DISPLAY, "zero_page");
+  assembler.emit(LDX_IMM, 0x00);
+  uint16_t loop = assembler.here();
+  assembler.emit(LDA_ZP_X, 0x00);
+  assembler.emit(CLC);
+  assembler.emit(ADC_IMM, 0x01);
+  assembler.emit(STA_ZP_X, 0x00);
+  assembler.emit(ADC_ZP_X, 0x80);
+  assembler.emit(EOR_ZP, G_COUNTER);
+  assembler.emit(STA_ZP, G_SCROLL);
+  assembler.emit(INC_ZP, G_COUNTER);
+  assembler.emit(DEC_ZP, G_SCROLL);
+  assembler.emit(INX);
+  assembler.emit_branch(BRA, loop);
+  return {.name = "zero_page",
+          .description = "Loads, stores and read-modify-writes on zero page",
+          .rom = assembler.get_rom()};
+}
+
+auto VRAM_UPLOAD() -> Workload {
+  Assembler assembler = Assembler();
+  EMIT_DEFAULT_VECTORS(assembler);
+  EMIT_PROLOGUE(assembler, G_CONTROL_DISPLAY, "vram_upload");
+  // Source pattern in RAM
+  assembler.emit(LDX_IMM, 0x00);
+  uint16_t fill = assembler.here();
+  assembler.emit(TXA);
+  assembler.emit_word(STA_ABS_X, G_UPLOAD_SOURCE);
+  assembler.emit(EOR_IMM, 0xFF);
+  assembler.emit_word(STA_ABS_X, G_UPLOAD_SOURCE + 0x100);
+  assembler.emit(INX);
+  assembler.emit_branch(BNE, fill);
+
+  // VRAM from the characters to the end per pass, 56 KiB in chunks like games
+  // upload tiles, so the pattern shows through the background
+  uint16_t loop = assembler.here();
+  EMIT_VDC_REGISTER(assembler, G_VDC_MAWR, G_VRAM_CHARACTERS);
+  assembler.emit(ST0, G_VDC_VWR);
+  assembler.emit(LDY_IMM,
+                 (G_VRAM_LENGTH - G_VRAM_CHARACTERS * 2) / G_UPLOAD_LENGTH);
+  uint16_t upload = assembler.here();
+  for (uint16_t offset = 0; offset < G_UPLOAD_LENGTH;
+       offset += G_UPLOAD_CHUNK) {
+    assembler.emit_block_transfer(TIA, G_UPLOAD_SOURCE + offset,
+                                  G_VDC_DATA_LOW, G_UPLOAD_CHUNK);
+  }
+  assembler.emit(DEY);
+  assembler.emit_branch(BNE, upload);
+  assembler.emit_word(JMP_ABS, loop);
+  return {.name = "vram_upload",
+          .description = "TIA block transfers from RAM to VRAM",
+          .rom = assembler.get_rom()};
+}
+
+auto TIMER_IRQ() -> Workload {
+  Assembler assembler = Assembler();
+  EMIT_DEFAULT_VECTORS(assembler);
+  uint16_t handler = assembler.here();
+  assembler.emit(PHA);
+  assembler.emit_word(STA_ABS, G_INTERRUPT_REQUEST);
+  assembler.emit(INC_ZP, G_COUNTER);
+  assembler.emit(PLA);
+  assembler.emit(RTI);
+  assembler.set_vector(G_VECTOR_TIMER, handler);
+
+  EMIT_PROLOGUE(assembler, G_CONTROL_DISPLAY, "timer_irq");
+  // Smallest reload so the handler runs as often as the timer allows
+  assembler.emit(CLA);
+  assembler.emit_word(STA_ABS, G_TIMER_RELOAD);
+  assembler.emit(LDA_IMM, 0x01);
+  assembler.emit_word(STA_ABS, G_TIMER_CONTROL);
+  assembler.emit(CLI);
+  uint16_t loop = assembler.here();
+  EMIT_ALU_LOOP(assembler);
+  assembler.emit_branch(BRA, loop);
+  return {.name = "timer_irq",
+          .description = "Arithmetic loops interrupted by the timer",
+          .rom = assembler.get_rom()};
+}
+
+auto VBLANK_IRQ() -> Workload {
+  Assembler assembler = Assembler();
+  EMIT_DEFAULT_VECTORS(assembler);
+  uint16_t handler = assembler.here();
+  assembler.emit(PHA);
+  assembler.emit_word(LDA_ABS, G_VDC_STATUS);
+  assembler.emit(LDA_IMM, 0x01);
+  assembler.emit(STA_ZP, G_VBLANK_FLAG);
+  assembler.emit(PLA);
+  assembler.emit(RTI);
+  assembler.set_vector(G_VECTOR_INTERRUPT_REQUEST_1, handler);
+
+  EMIT_PROLOGUE(assembler, G_CONTROL_DISPLAY | G_CONTROL_VBLANK_IRQ,
+                "vblank_irq");
+  assembler.emit(CLI);
+  // Busy-waits on the flag like most games, then scrolls the background
+  uint16_t loop = assembler.here();
+  assembler.emit(LDA_ZP, G_VBLANK_FLAG);
+  assembler.emit_branch(BEQ, loop);
+  assembler.emit(STZ_ZP, G_VBLANK_FLAG);
+  assembler.emit(INC_ZP, G_SCROLL);
+  assembler.emit(ST0, G_VDC_BXR);
+  assembler.emit(LDA_ZP, G_SCROLL);
+  assembler.emit_word(STA_ABS, G_VDC_DATA_LOW);
+  assembler.emit(CLA);
+  assembler.emit_word(STA_ABS, G_VDC_DATA_HIGH);
+  assembler.emit_branch(BRA, loop);
+  return {.name = "vblank_irq",
+          .description = "Frame loop driven by the VDC vertical blank IRQ",
+          .rom = assembler.get_rom()};
+}
+
+auto Sakura::Workloads::GENERATE_WORKLOADS() -> std::vector<Workload> {
+  return {ALU(), ZERO_PAGE(), VRAM_UPLOAD(), TIMER_IRQ(), VBLANK_IRQ()};
+}
@@ -0,0 +1,26 @@
+#ifndef SAKURA_WORKLOADS_HPP
+#define SAKURA_WORKLOADS_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sakura::Workloads {
+
+struct Workload {
+  std::string name;
+  std::string description;
+  std::vector<uint8_t> rom;
+};
+
+/*
+Synthetic ROM images that stand in for commercial games, which can't be
+shipped with the project. Every workload sets up the display like a game
+would, uploading a background and sprites of its own, so the VDC renders real
+frames, and then loops forever on one kind of work. Images are generated at
+run time and are identical between runs.
+*/
+auto GENERATE_WORKLOADS() -> std::vector<Workload>;
+}; // namespace Sakura::Workloads
+
+#endif
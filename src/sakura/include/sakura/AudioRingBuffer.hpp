@@ -0,0 +1,93 @@
+#ifndef SAKURA_AUDIO_RING_BUFFER_HPP
+#define SAKURA_AUDIO_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sakura {
+
+/*
+Single producer, single consumer queue of interleaved stereo int16 samples.
+The PSG writes every rendered block from the emulator thread, the host audio
+callback or a file writer reads from any other thread. Positions only ever
+grow and are masked on access, so neither side locks or waits. When the
+queue is full the newest samples are dropped, when it runs dry the reader
+gets silence; both are counted so the frontend can steer the fill level.
+*/
+class AudioRingBuffer {
+private:
+  std::vector<int16_t> m_samples;
+  size_t m_capacity;
+  std::atomic<size_t> m_write;
+  std::atomic<size_t> m_read;
+  std::atomic<uint64_t> m_overruns;
+  std::atomic<uint64_t> m_underruns;
+
+public:
+  // Capacity in stereo samples, rounded up to a power of two
+  explicit AudioRingBuffer(size_t capacity)
+      : m_capacity(1), m_write(0), m_read(0), m_overruns(0), m_underruns(0) {
+    while (m_capacity < capacity) {
+      m_capacity <<= 1;
+    }
+    m_samples.resize(m_capacity * 2);
+  }
+  ~AudioRingBuffer() = default;
+
+  AudioRingBuffer(const AudioRingBuffer &) = delete;
+  auto operator=(const AudioRingBuffer &) -> AudioRingBuffer & = delete;
+
+  auto write(const int16_t *samples, size_t count) -> size_t {
+    size_t write = m_write.load(std::memory_order_relaxed);
+    size_t read = m_read.load(std::memory_order_acquire);
+    size_t written = std::min(count, m_capacity - (write - read));
+    for (size_t i = 0; i < written; i++) {
+      size_t index = ((write + i) & (m_capacity - 1)) * 2;
+      m_samples[index] = samples[i * 2];
+      m_samples[index + 1] = samples[i * 2 + 1];
+    }
+    m_write.store(write + written, std::memory_order_release);
+    if (written < count) {
+      m_overruns.fetch_add(count - written, std::memory_order_relaxed);
+    }
+    return written;
+  }
+
+  // Always fills count samples, the ones missing are silent
+  auto read(int16_t *samples, size_t count) -> size_t {
+    size_t read = m_read.load(std::memory_order_relaxed);
+    size_t write = m_write.load(std::memory_order_acquire);
+    size_t available = std::min(count, write - read);
+    for (size_t i = 0; i < available; i++) {
+      size_t index = ((read + i) & (m_capacity - 1)) * 2;
+      samples[i * 2] = m_samples[index];
+      samples[i * 2 + 1] = m_samples[index + 1];
+    }
+    m_read.store(read + available, std::memory_order_release);
+    if (available < count) {
+      std::fill(samples + available * 2, samples + count * 2, 0);
+      m_underruns.fetch_add(count - available, std::memory_order_relaxed);
+    }
+    return available;
+  }
+
+  [[nodiscard]] auto get_capacity() const -> size_t { return m_capacity; }
+  [[nodiscard]] auto get_fill_level() const -> size_t {
+    size_t read = m_read.load(std::memory_order_acquire);
+    return m_write.load(std::memory_order_acquire) - read;
+  }
+  // Stereo samples dropped because the queue was full
+  [[nodiscard]] auto get_overruns() const -> uint64_t {
+    return m_overruns.load(std::memory_order_relaxed);
+  }
+  // Stereo samples replaced with silence because the queue was empty
+  [[nodiscard]] auto get_underruns() const -> uint64_t {
+    return m_underruns.load(std::memory_order_relaxed);
+  }
+};
+}; // namespace Sakura
+
+#endif
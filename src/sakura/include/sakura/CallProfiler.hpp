@@ -0,0 +1,91 @@
+#ifndef SAKURA_CALL_PROFILER_HPP
+#define SAKURA_CALL_PROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sakura {
+
+enum class CallType : uint8_t {
+  // Entered with JSR or BSR, left with RTS
+  Subroutine,
+  // Entered by the processor, left with RTI
+  Interrupt
+};
+
+struct CallProfileFunction {
+  // MPR bank in the upper 8 bits, offset in the bank in the lower 13
+  uint32_t physical_address;
+  CallType type;
+  uint64_t calls;
+  // Cycles spent in the function and everything it called, recursive calls
+  // are only counted once
+  uint64_t inclusive_cycles;
+  uint64_t exclusive_cycles;
+};
+
+/*
+Shadow call stack of the guest, fed with the cycles of every instruction and
+with the calls and returns the processor makes. Cycles are accumulated in a
+call tree, one node per distinct call path, so the output can be folded into
+flame graphs. The stack has a fixed depth and the tree a fixed number of
+nodes, both allocated up front. Calls past the maximum depth are counted in
+their caller, as are new call paths once the tree is full, so long runs stay
+cheap and bounded. Returns that don't match a call, like RTS used as a jump,
+are ignored.
+*/
+class CallProfiler {
+private:
+  struct Node {
+    uint32_t physical_address;
+    CallType type;
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+    uint64_t calls;
+    uint64_t exclusive_cycles;
+  };
+
+  struct Frame {
+    uint32_t node;
+    CallType type;
+  };
+
+  std::vector<Node> m_nodes;
+  size_t m_max_nodes;
+  std::vector<Frame> m_stack;
+  size_t m_depth;
+  // Calls past the maximum depth, only counted so their returns match
+  size_t m_untracked_depth;
+  uint32_t m_current;
+  uint64_t m_dropped_calls;
+
+  [[nodiscard]] auto get_frame_name(uint32_t node) const -> std::string;
+
+public:
+  CallProfiler(size_t max_depth, size_t max_nodes);
+  ~CallProfiler() = default;
+
+  void add_cycles(uint8_t cycles) {
+    m_nodes[m_current].exclusive_cycles += cycles;
+  }
+  void enter(uint32_t physical_address, CallType type);
+  void leave(CallType type);
+  void clear();
+
+  // One line per call path with the cycles spent in its last function, in
+  // the folded format flame graph tools take
+  [[nodiscard]] auto get_folded_stacks() const -> std::string;
+  // Every function called, the most inclusive cycles first
+  [[nodiscard]] auto get_functions() const -> std::vector<CallProfileFunction>;
+  [[nodiscard]] auto get_report(size_t count) const -> std::string;
+  // Calls attributed to their caller because the stack or the tree was full
+  [[nodiscard]] auto get_dropped_calls() const -> uint64_t {
+    return m_dropped_calls;
+  }
+};
+}; // namespace Sakura
+
+#endif
@@ -1,6 +1,12 @@
 #ifndef SAKURA_CONSTANTS_HPP
 #define SAKURA_CONSTANTS_HPP
 
+// Master clock, every cycle count in the emulator is in these
+constexpr unsigned int CYCLES_PER_SECOND = 21477270;
+constexpr double FRAME_RATE = 60.0;
+
+constexpr unsigned int VRAM_LENGTH = 0x8000;
+
 constexpr unsigned int COLOR_TABLE_RAM_NUMBER_OF_COLORS_PER_AREA = 16;
 constexpr unsigned int COLOR_TABLE_RAM_NUMBER_OF_AREAS = 16;
 constexpr unsigned int COLOR_TABLE_RAM_NUMBER_OF_SECTIONS = 2;
@@ -18,14 +24,12 @@ constexpr unsigned int CHARACTER_DOTS =
     CHARACTER_DOTS_WIDTH * CHARACTER_DOTS_HEIGHT;
 constexpr unsigned int CHARACTER_DATA_LENGTH = CHARACTER_DOTS * 3;
 
-constexpr unsigned int BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_ROWS = 32;
-constexpr unsigned int BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW =
-    32;
-constexpr unsigned int BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS =
-    BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_ROWS *
-    BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW;
-constexpr unsigned int BACKGROUND_ATTRIBUTE_TABLE_DATA_LENGTH =
-    BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS * CHARACTER_DATA_LENGTH;
+constexpr unsigned int BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_ROWS = 64;
+constexpr unsigned int
+    BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_CHARACTERS_PER_ROW = 128;
+constexpr unsigned int BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_CHARACTERS =
+    BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_ROWS *
+    BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_CHARACTERS_PER_ROW;
 
 constexpr unsigned int BACKGROUND_CHARACTER_GENERATOR_WORDS_LENGTH = 16;
 
@@ -37,4 +41,12 @@ constexpr unsigned int CHARACTER_GENERATOR_NUMBER_OF_CHARACTERS =
 constexpr unsigned int CHARACTER_GENERATOR_DATA_LENGTH =
     CHARACTER_GENERATOR_NUMBER_OF_CHARACTERS * CHARACTER_DATA_LENGTH;
 
+constexpr unsigned int FRAME_BUFFER_MAX_WIDTH = 512;
+constexpr unsigned int FRAME_BUFFER_MAX_HEIGHT = 263;
+constexpr unsigned int FRAME_BUFFER_MAX_DOTS =
+    FRAME_BUFFER_MAX_WIDTH * FRAME_BUFFER_MAX_HEIGHT;
+constexpr unsigned int FRAME_BUFFER_DATA_LENGTH = FRAME_BUFFER_MAX_DOTS * 3;
+
+constexpr unsigned int AUDIO_SAMPLE_RATE = 48000;
+
 #endif
@@ -1,11 +1,20 @@
 #ifndef SAKURA_EMULATOR_HPP
 #define SAKURA_EMULATOR_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <sakura/CallProfiler.hpp>
 #include <sakura/Constants.hpp>
+#include <sakura/InputMovie.hpp>
+#include <sakura/Lockstep.hpp>
+#include <sakura/OpcodeProfiler.hpp>
+#include <sakura/PCSampler.hpp>
 #include <sakura/RendererInfo.hpp>
+#include <sakura/TraceBuffer.hpp>
+#include <vector>
 
 namespace Sakura {
 namespace HuC6280 {
@@ -15,6 +24,9 @@ class Controller;
 namespace Interrupt {
 class Controller;
 } // namespace Interrupt
+namespace ProgrammableSoundGenerator {
+class Controller;
+} // namespace ProgrammableSoundGenerator
 class Processor;
 class Disassembler;
 } // namespace HuC6280
@@ -24,6 +36,9 @@ class Controller;
 namespace HuC6260 {
 class Controller;
 } // namespace HuC6260
+class FrameSink;
+class AudioRingBuffer;
+struct Machine;
 
 /*
 Possible values: "trace", "debug", "info", "warning", "error", "critical", "off"
@@ -59,13 +74,34 @@ private:
   std::unique_ptr<HuC6280::Interrupt::Controller> m_interrupt_controller;
   std::unique_ptr<HuC6260::Controller> m_video_color_encoder_controller;
   std::unique_ptr<HuC6270::Controller> m_video_display_controller;
+  std::unique_ptr<HuC6280::ProgrammableSoundGenerator::Controller>
+      m_programmable_sound_generator_controller;
   std::unique_ptr<HuC6280::Mapping::Controller> m_mapping_controller;
   std::unique_ptr<HuC6280::Processor> m_processor;
   std::unique_ptr<HuC6280::Disassembler> m_disassembler;
   std::unique_ptr<RendererInfo> m_renderer_info;
+  std::unique_ptr<OpcodeProfiler> m_opcode_profiler;
 
   bool m_should_pause;
+  uint64_t m_executed_instructions;
+  uint64_t m_executed_cycles;
+  uint64_t m_frame;
+
+  std::function<void(std::unique_ptr<RendererInfo> &)> m_vsync_callback;
+  std::atomic<uint8_t> m_joypad_buttons;
+  std::shared_ptr<InputMovie> m_input_movie;
+  InputMovieMode m_input_movie_mode;
+  std::shared_ptr<PCSampler> m_pc_sampler;
+  std::shared_ptr<CallProfiler> m_call_profiler;
+  std::shared_ptr<TraceBuffer> m_trace_buffer;
+  // Snapshots are loaded here first, created on the first load
+  std::unique_ptr<Machine> m_state_scratch;
 
+  void step();
+  void trace(uint8_t opcode);
+  void profile_call(uint8_t opcode, uint8_t cycles);
+  [[nodiscard]] auto get_physical_program_counter() const -> uint32_t;
+  void vsync();
   static void register_loggers(const LogLevelConfig &log_level_config,
                                const LogFormatterConfig &log_formatter_config);
 
@@ -75,13 +111,82 @@ public:
   ~Emulator();
 
   void emulate();
+  void emulate_cycles(uint64_t cycles);
+  void emulate_instructions(uint64_t instructions);
+  // Up to the vertical sync that ends the last frame
+  void emulate_frames(uint64_t frames);
   void initialize(const std::filesystem::path &rom,
                   const LogLevelConfig &log_level_config,
                   const LogFormatterConfig &log_formatter_config);
+  // ROM image already in memory, laid out as it would be in a file
+  void initialize(const std::vector<uint8_t> &rom,
+                  const LogLevelConfig &log_level_config,
+                  const LogFormatterConfig &log_formatter_config);
   void
   set_vsync_callback(const std::function<void(std::unique_ptr<RendererInfo> &)>
                          &vsync_callback);
+  // Defaults to AUDIO_SAMPLE_RATE, has to be set before emulation starts
+  void set_audio_sample_rate(unsigned int sample_rate);
+  // Called from the emulator thread with interleaved stereo samples every
+  // time the PSG finishes rendering a block
+  void set_audio_callback(
+      const std::function<void(const std::vector<float> &)> &audio_callback);
+  void set_int16_audio_callback(
+      const std::function<void(const std::vector<int16_t> &)>
+          &int16_audio_callback);
+  // Ring buffers have to be attached before emulation starts
+  void attach_audio_ring_buffer(
+      const std::shared_ptr<AudioRingBuffer> &audio_ring_buffer);
+  // Dynamic rate control: ratio slightly above 1 produces more samples per
+  // emulated second, call it from the emulator thread
+  void set_audio_rate_adjustment(double ratio);
   void set_should_pause();
+  // Bitmask of JoypadButton, can be called from any thread and is latched at
+  // the start of the next frame
+  void set_joypad_buttons(uint8_t buttons);
+  void attach_input_movie(const std::shared_ptr<InputMovie> &input_movie,
+                          InputMovieMode mode);
+  // Samples the program counter of the next instruction to run
+  void attach_pc_sampler(const std::shared_ptr<PCSampler> &pc_sampler);
+  // Most sampled addresses with their disassembly, has to be called while
+  // the emulator is not running
+  auto get_pc_sampler_report(size_t count) -> std::string;
+  // Follows JSR, BSR, RTS, RTI and interrupts taken from the next
+  // instruction on
+  void attach_call_profiler(const std::shared_ptr<CallProfiler> &call_profiler);
+  // Records every instruction from the next one on, the buffer has to be
+  // open
+  void attach_trace_buffer(const std::shared_ptr<TraceBuffer> &trace_buffer);
+  // Disassembly of a traced instruction, for decoders. Extension is null
+  // unless the instruction has one. Has to be called while the emulator is
+  // not running
+  auto disassemble(const TraceRecord &record, const TraceRecord *extension)
+      -> std::string;
+  // Has to be called while the emulator is not running
+  auto disassemble_next_instruction() -> std::string;
+  // Registers and hashes of RAM, VRAM and the color table, for comparing
+  // emulators. Has to be called while the emulator is not running
+  auto get_state_digest() const -> StateDigest;
+  // Sinks have to be attached before emulation starts
+  void attach_frame_sink(const std::shared_ptr<FrameSink> &frame_sink);
+  // Snapshot of every controller in a compact binary format, the ROM is not
+  // included. The vector keeps its capacity so it can be reused
+  void save_state(std::vector<uint8_t> &state) const;
+  // Has to be called while the emulator is not running. False when the
+  // snapshot is corrupted or from another version, the emulator is then left
+  // as it was
+  auto load_state(const std::vector<uint8_t> &state) -> bool;
+  auto get_renderer_info() -> std::unique_ptr<RendererInfo> &;
+  // Stays empty unless built with SAKURA_OPCODE_PROFILER, only safe to read
+  // from the emulator thread or while the emulator is not running
+  auto get_opcode_profiler() -> std::unique_ptr<OpcodeProfiler> &;
+  [[nodiscard]] auto get_executed_instructions() const -> uint64_t {
+    return m_executed_instructions;
+  }
+  [[nodiscard]] auto get_executed_cycles() const -> uint64_t {
+    return m_executed_cycles;
+  }
+  [[nodiscard]] auto get_frame() const -> uint64_t { return m_frame; }
 };
 }; // namespace Sakura
 
@@ -0,0 +1,78 @@
+#ifndef SAKURA_FRAME_PACER_HPP
+#define SAKURA_FRAME_PACER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace Sakura {
+class AudioRingBuffer;
+
+enum class FramePacingMode {
+  // Deadlines from a steady clock at FRAME_RATE
+  Clock,
+  // Waits until the host audio device has drained the ring buffer down to a
+  // target fill level, so video follows the audio clock
+  Audio
+};
+
+struct FramePacerStatistics {
+  uint64_t frames;
+  // Time between the end of two consecutive waits
+  double average_interval_ms;
+  // Distance between each interval and the frame period
+  double average_jitter_ms;
+  double max_jitter_ms;
+  // Intervals longer than one and a half frame periods
+  uint64_t late_frames;
+  // Share of host time spent waiting rather than emulating
+  double idle_ratio;
+};
+
+/*
+Paces the emulator to real time with one call to wait() per emulated frame.
+Waits sleep for most of the remaining time and only spin with yields for the
+last stretch, the spin window adapts to how late the sleeps wake up.
+*/
+class FramePacer {
+private:
+  using Clock = std::chrono::steady_clock;
+
+  FramePacingMode m_mode;
+  Clock::duration m_frame_period;
+  std::shared_ptr<AudioRingBuffer> m_audio_ring_buffer;
+  size_t m_audio_target_fill_level;
+
+  bool m_started;
+  Clock::time_point m_deadline;
+  Clock::time_point m_last_frame;
+  Clock::duration m_spin_window;
+
+  uint64_t m_frames;
+  Clock::duration m_total_interval;
+  Clock::duration m_total_jitter;
+  Clock::duration m_max_jitter;
+  Clock::duration m_total_waited;
+  uint64_t m_late_frames;
+
+  void sleep_until(Clock::time_point deadline);
+  void wait_for_audio();
+  void record(Clock::time_point now, Clock::duration waited);
+
+public:
+  explicit FramePacer(double frame_rate);
+  ~FramePacer() = default;
+
+  // Switches to FramePacingMode::Audio
+  void set_audio_ring_buffer(
+      const std::shared_ptr<AudioRingBuffer> &audio_ring_buffer,
+      size_t target_fill_level);
+  void wait();
+
+  [[nodiscard]] auto get_mode() const -> FramePacingMode { return m_mode; }
+  [[nodiscard]] auto get_statistics() const -> FramePacerStatistics;
+  void reset_statistics();
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef SAKURA_FRAME_SINK_HPP
+#define SAKURA_FRAME_SINK_HPP
+
+#include "sakura/Constants.hpp"
+#include "sakura/TripleBuffer.hpp"
+#include <array>
+#include <cstdint>
+
+namespace Sakura {
+
+struct Frame {
+  uint64_t sequence;
+  unsigned int width;
+  unsigned int height;
+  // Color table RAM addresses, rows are width dots apart
+  std::array<uint16_t, FRAME_BUFFER_MAX_DOTS> dots;
+  // Color table RAM entries as stored by the HuC6260 (GGGRRRBBB)
+  std::array<uint16_t, COLOR_TABLE_RAM_NUMBER_OF_COLORS> color_table;
+
+  void get_rgb_data(std::array<float, FRAME_BUFFER_DATA_LENGTH> &data) const;
+};
+
+/*
+Completed frames published by the VDC at the end of the active display. The
+emulator thread is the only producer, a single consumer on any other thread
+reads the latest frame in place without locking. Attach one sink per
+consumer.
+*/
+class FrameSink {
+private:
+  TripleBuffer<Frame> m_frames;
+
+public:
+  FrameSink() = default;
+  ~FrameSink() = default;
+
+  FrameSink(const FrameSink &) = delete;
+  auto operator=(const FrameSink &) -> FrameSink & = delete;
+
+  auto back() -> Frame & { return m_frames.back(); }
+  void publish() { m_frames.publish(); }
+
+  auto consume() -> bool { return m_frames.consume(); }
+  [[nodiscard]] auto front() const -> const Frame & { return m_frames.front(); }
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef SAKURA_INPUT_MOVIE_HPP
+#define SAKURA_INPUT_MOVIE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Sakura {
+
+enum class InputMovieMode {
+  // Logs the joypad state latched at every frame
+  Record,
+  // Replaces the joypad state with the logged one
+  Playback
+};
+
+struct InputEvent {
+  uint32_t frame;
+  uint8_t buttons;
+};
+
+/*
+Joypad state keyed by emulated frame, only frames where it changes are
+stored. Input is latched once per frame at vertical sync, so replaying a
+movie from power on reproduces the recorded run exactly regardless of host
+speed. Recording over an earlier frame, after loading a state or rewinding,
+drops everything logged after it.
+*/
+class InputMovie {
+private:
+  std::vector<InputEvent> m_events;
+
+public:
+  InputMovie() = default;
+  ~InputMovie() = default;
+
+  void record(uint64_t frame, uint8_t buttons);
+  [[nodiscard]] auto get_buttons(uint64_t frame) const -> uint8_t;
+  // Frame of the last change
+  [[nodiscard]] auto get_length() const -> uint64_t;
+  [[nodiscard]] auto get_events() const -> const std::vector<InputEvent> & {
+    return m_events;
+  }
+
+  [[nodiscard]] auto save(const std::filesystem::path &path) const -> bool;
+  auto load(const std::filesystem::path &path) -> bool;
+};
+}; // namespace Sakura
+
+#endif
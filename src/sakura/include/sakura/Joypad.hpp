@@ -0,0 +1,22 @@
+#ifndef SAKURA_JOYPAD_HPP
+#define SAKURA_JOYPAD_HPP
+
+#include <cstdint>
+
+namespace Sakura {
+
+// Pressed buttons are set bits, the low nibble is read with SEL low and the
+// high nibble with SEL high
+enum JoypadButton : uint8_t {
+  I = 1 << 0,
+  II = 1 << 1,
+  Select = 1 << 2,
+  Run = 1 << 3,
+  Up = 1 << 4,
+  Right = 1 << 5,
+  Down = 1 << 6,
+  Left = 1 << 7,
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef SAKURA_LOCKSTEP_HPP
+#define SAKURA_LOCKSTEP_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace Sakura {
+class Emulator;
+
+// Everything two emulators running the same program have to agree on,
+// memories are reduced to hashes
+struct StateDigest {
+  uint64_t instructions;
+  uint64_t cycles;
+  uint16_t program_counter;
+  uint8_t accumulator;
+  uint8_t x;
+  uint8_t y;
+  uint8_t stack_pointer;
+  uint8_t status;
+  uint64_t ram_hash;
+  uint64_t vram_hash;
+  uint64_t color_table_hash;
+};
+
+enum class LockstepGranularity {
+  Instruction,
+  // A fixed number of cycles, rounded up to the next instruction
+  Block,
+  Frame
+};
+
+/*
+Runs a candidate emulator, usually built on another execution engine, in
+lockstep with a reference one and compares their digests after every step.
+Both have to be initialized with the same ROM and state. Comparing every
+instruction finds the exact one that diverges but hashes every memory each
+time, blocks and frames are much cheaper for long runs and can be narrowed
+down afterwards.
+*/
+class Lockstep {
+private:
+  Emulator &m_reference;
+  Emulator &m_candidate;
+  LockstepGranularity m_granularity;
+  uint64_t m_block_cycles;
+  uint64_t m_steps;
+  StateDigest m_last_digest;
+  std::string m_report;
+
+  void advance(Emulator &emulator) const;
+  [[nodiscard]] auto get_context(const StateDigest &reference,
+                                 const StateDigest &candidate) -> std::string;
+
+public:
+  Lockstep(Emulator &reference, Emulator &candidate,
+           LockstepGranularity granularity, uint64_t block_cycles);
+  ~Lockstep() = default;
+
+  // Advances both emulators by one step, false once they diverged
+  auto step() -> bool;
+  [[nodiscard]] auto get_steps() const -> uint64_t { return m_steps; }
+  // Context of the divergence, empty while the emulators agree
+  [[nodiscard]] auto get_report() const -> const std::string & {
+    return m_report;
+  }
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef SAKURA_OPCODE_PROFILER_HPP
+#define SAKURA_OPCODE_PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Sakura {
+
+// One instruction in every interval has its handler timed
+constexpr unsigned int OPCODE_PROFILER_SAMPLE_INTERVAL = 64;
+
+struct OpcodeProfile {
+  uint8_t opcode;
+  uint64_t executions;
+  uint64_t cycles;
+  // Average of the timed executions scaled to all of them
+  double host_nanoseconds;
+};
+
+/*
+Counts executions and emulated cycles per opcode in plain arrays indexed by
+opcode. Host time is sampled, timing every handler would cost more than most
+handlers take to run. Ticks come from the time stamp counter where there is
+one and are converted to nanoseconds against the steady clock when reporting.
+The emulator only feeds the profiler when built with SAKURA_OPCODE_PROFILER.
+*/
+class OpcodeProfiler {
+private:
+  using Clock = std::chrono::steady_clock;
+
+  std::array<uint64_t, 0x100> m_executions;
+  std::array<uint64_t, 0x100> m_cycles;
+  std::array<uint64_t, 0x100> m_samples;
+  std::array<uint64_t, 0x100> m_sampled_ticks;
+  unsigned int m_countdown;
+
+  Clock::time_point m_start_time;
+  uint64_t m_start_ticks;
+
+  [[nodiscard]] auto get_nanoseconds_per_tick() const -> double;
+
+public:
+  OpcodeProfiler();
+  ~OpcodeProfiler() = default;
+
+  // Whether the emulator was built to feed the profiler
+  [[nodiscard]] static auto is_compiled_in() -> bool;
+
+  static auto read_ticks() -> uint64_t {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               Clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+
+  auto should_sample() -> bool {
+    if (--m_countdown != 0) {
+      return false;
+    }
+    m_countdown = OPCODE_PROFILER_SAMPLE_INTERVAL;
+    return true;
+  }
+
+  void record(uint8_t opcode, uint8_t cycles) {
+    m_executions[opcode]++;
+    m_cycles[opcode] += cycles;
+  }
+
+  void record_sample(uint8_t opcode, uint64_t ticks) {
+    m_samples[opcode]++;
+    m_sampled_ticks[opcode] += ticks;
+  }
+
+  void reset();
+  // Executed opcodes, the most host time first
+  [[nodiscard]] auto get_profile() const -> std::vector<OpcodeProfile>;
+  // Table of get_profile() with each opcode's share of the totals
+  [[nodiscard]] auto get_report() const -> std::string;
+};
+}; // namespace Sakura
+
+#endif
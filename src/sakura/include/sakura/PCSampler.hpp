@@ -0,0 +1,56 @@
+#ifndef SAKURA_PC_SAMPLER_HPP
+#define SAKURA_PC_SAMPLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sakura {
+
+struct PCSample {
+  // MPR bank in the upper 8 bits, offset in the bank in the lower 13
+  uint32_t physical_address;
+  // Where the address was last seen mapped
+  uint16_t logical_address;
+  uint64_t count;
+};
+
+/*
+Histogram of the guest program counter sampled every interval cycles. Samples
+are keyed by physical address, so a routine is counted once no matter which
+MPR it runs from. The histogram is an open addressing table of fixed size
+allocated up front, samples that find it full are only counted as dropped.
+*/
+class PCSampler {
+private:
+  std::vector<PCSample> m_slots;
+  int64_t m_interval;
+  int64_t m_countdown;
+  uint64_t m_samples;
+  uint64_t m_dropped;
+
+public:
+  // Capacity is rounded up to a power of two
+  explicit PCSampler(unsigned int interval, size_t capacity);
+  ~PCSampler() = default;
+
+  // Called with the cycles of every instruction, true once a sample is due
+  auto step(uint8_t cycles) -> bool {
+    m_countdown -= cycles;
+    if (m_countdown > 0) {
+      return false;
+    }
+    m_countdown += m_interval;
+    return true;
+  }
+
+  void sample(uint32_t physical_address, uint16_t logical_address);
+  void clear();
+  // The count most sampled addresses, most samples first
+  [[nodiscard]] auto get_top(size_t count) const -> std::vector<PCSample>;
+  [[nodiscard]] auto get_samples() const -> uint64_t { return m_samples; }
+  [[nodiscard]] auto get_dropped() const -> uint64_t { return m_dropped; }
+};
+}; // namespace Sakura
+
+#endif
@@ -2,7 +2,11 @@
 #define SAKURA_RENDERERINFO_HPP
 
 #include "sakura/Constants.hpp"
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace Sakura {
 namespace HuC6270 {
@@ -12,6 +16,13 @@ namespace HuC6260 {
 class Controller;
 } // namespace HuC6260
 
+struct DirtyRectangle {
+  unsigned int x;
+  unsigned int y;
+  unsigned int width;
+  unsigned int height;
+};
+
 class RendererInfo {
 private:
   std::unique_ptr<HuC6270::Controller> &m_video_display_controller;
@@ -24,8 +35,14 @@ public:
   ~RendererInfo() = default;
 
   auto get_color_table_data() -> std::array<float, COLOR_TABLE_RAM_DATA_LENGTH>;
-  auto get_background_attribute_table_data()
-      -> std::array<float, BACKGROUND_ATTRIBUTE_TABLE_DATA_LENGTH>;
+  auto get_background_attribute_table_data(
+      std::vector<DirtyRectangle> &dirty_rectangles)
+      -> const std::vector<float> &;
+  auto get_background_attribute_table_dimensions()
+      -> std::pair<unsigned int, unsigned int>;
+  auto get_frame_buffer_data() -> std::array<float, FRAME_BUFFER_DATA_LENGTH>;
+  auto get_frame_buffer_dimensions() -> std::pair<unsigned int, unsigned int>;
+  auto get_vram_data() -> const std::array<uint16_t, VRAM_LENGTH> &;
   auto get_character_generator_data()
       -> std::array<float, CHARACTER_GENERATOR_DATA_LENGTH>;
 };
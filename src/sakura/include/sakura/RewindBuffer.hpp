@@ -0,0 +1,63 @@
+#ifndef SAKURA_REWIND_BUFFER_HPP
+#define SAKURA_REWIND_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Sakura {
+class Emulator;
+
+/*
+Keeps a history of save states in a fixed size arena. Only the latest
+snapshot is stored as is, every older one is stored as the XOR of itself and
+the snapshot that followed it. Between two snapshots most of VRAM and RAM
+does not change, so those deltas are long runs of zeros that are run length
+encoded down to a few bytes. Stepping back loads the latest snapshot and
+applies the newest delta to it, once the arena is full the oldest deltas are
+dropped.
+*/
+class RewindBuffer {
+private:
+  struct Entry {
+    size_t offset;
+    size_t length;
+    // Size of the snapshot the delta restores
+    size_t state_length;
+  };
+
+  std::vector<uint8_t> m_arena;
+  size_t m_head;
+  std::deque<Entry> m_entries;
+  unsigned int m_interval;
+  uint64_t m_frames;
+
+  std::vector<uint8_t> m_latest;
+  std::vector<uint8_t> m_snapshot;
+  std::vector<uint8_t> m_delta;
+
+  void push_delta(size_t state_length);
+  void drop_overlapping_entries(size_t offset, size_t length);
+
+public:
+  // Capacity of the arena in bytes, a snapshot is taken every interval frames
+  RewindBuffer(size_t capacity, unsigned int interval);
+  ~RewindBuffer() = default;
+
+  // Called once per frame while the emulator is not running
+  void push(const Emulator &emulator);
+  // Loads the latest snapshot and makes the one before it the latest, false
+  // when there is nothing to go back to
+  auto rewind(Emulator &emulator) -> bool;
+  void clear();
+
+  // Snapshots that can be loaded, including the latest one
+  [[nodiscard]] auto get_count() const -> size_t;
+  // Bytes taken by the deltas in the arena
+  [[nodiscard]] auto get_used_bytes() const -> size_t;
+  [[nodiscard]] auto get_capacity() const -> size_t { return m_arena.size(); }
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef SAKURA_TELEMETRY_HPP
+#define SAKURA_TELEMETRY_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Sakura {
+
+enum class TelemetryPhase {
+  // Emulate call, without the vertical sync callback
+  Emulation,
+  VsyncCallback,
+  // Building the UI and issuing draw calls
+  Render,
+  // Swapping buffers
+  Present
+};
+constexpr size_t TELEMETRY_NUMBER_OF_PHASES = 4;
+
+struct TelemetryStatistics {
+  uint64_t frames;
+  // Nanoseconds, upper bounds of the histogram buckets capped at the max
+  uint64_t p50;
+  uint64_t p95;
+  uint64_t p99;
+  // Exact, not bucketed
+  uint64_t max;
+};
+
+/*
+Per frame timings of every phase of the frontend loop, in a fixed log-linear
+histogram per phase: each power of two of nanoseconds is split in 16 buckets,
+so percentiles are within about 6% of the exact value and recording never
+allocates. Phases can be recorded from different threads and read from any
+thread, counts are relaxed atomics and a snapshot may be a frame behind.
+*/
+class Telemetry {
+public:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  static constexpr unsigned int SUB_BUCKET_BITS = 4;
+  // Longer durations land in the last bucket, 2^36 ns is about 68 s
+  static constexpr unsigned int MAX_EXPONENT = 35;
+  static constexpr size_t NUMBER_OF_BUCKETS =
+      (MAX_EXPONENT - SUB_BUCKET_BITS + 2) << SUB_BUCKET_BITS;
+
+  struct Histogram {
+    std::array<std::atomic<uint64_t>, NUMBER_OF_BUCKETS> counts;
+    std::atomic<uint64_t> frames;
+    std::atomic<uint64_t> max;
+  };
+  std::array<Histogram, TELEMETRY_NUMBER_OF_PHASES> m_histograms;
+
+  static auto get_bucket(uint64_t nanoseconds) -> size_t;
+  static auto get_bucket_lower_bound(size_t bucket) -> uint64_t;
+  static auto get_bucket_upper_bound(size_t bucket) -> uint64_t;
+  [[nodiscard]] auto get_percentile(const Histogram &histogram,
+                                    uint64_t frames, double percentile) const
+      -> uint64_t;
+
+public:
+  Telemetry();
+  ~Telemetry() = default;
+  Telemetry(const Telemetry &) = delete;
+  auto operator=(const Telemetry &) -> Telemetry & = delete;
+
+  void record(TelemetryPhase phase, Clock::duration duration);
+  [[nodiscard]] auto get_statistics(TelemetryPhase phase) const
+      -> TelemetryStatistics;
+  // Non-empty buckets of every phase, one per row
+  [[nodiscard]] auto get_csv() const -> std::string;
+  void reset();
+
+  static auto get_phase_name(TelemetryPhase phase) -> const char *;
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef SAKURA_TRACE_BUFFER_HPP
+#define SAKURA_TRACE_BUFFER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Sakura {
+
+// Processor state right before an instruction runs. Block transfers take
+// six operand bytes, the last three go in an extension record written right
+// before the instruction with the same cycle
+struct TraceRecord {
+  // Low 32 bits of the cycle count
+  uint32_t cycle;
+  uint16_t program_counter;
+  // MPR bank the program counter was mapped to
+  uint8_t bank;
+  uint8_t opcode;
+  std::array<uint8_t, 3> operands;
+  uint8_t accumulator;
+  uint8_t x;
+  uint8_t y;
+  uint8_t stack_pointer;
+  uint8_t status;
+};
+static_assert(sizeof(TraceRecord) == 16, "Trace records are 16 bytes");
+
+struct TraceHeader {
+  std::array<char, 4> magic;
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t reserved;
+  uint64_t capacity;
+  // Records written since the trace was opened, the ring holds the latest
+  // capacity of them
+  uint64_t written;
+};
+static_assert(sizeof(TraceHeader) == 32, "Trace headers are 32 bytes");
+
+/*
+Ring of binary trace records in a memory mapped file. A record is a plain
+copy of the registers and the instruction bytes, nothing is formatted while
+the emulator runs and the file is never grown, so tracing can stay on for
+long runs. The header and the records live in the mapping, the kernel writes
+them back even if the emulator crashes. Records are stored in host byte
+order and decoded offline.
+*/
+class TraceBuffer {
+private:
+  void *m_mapping;
+  size_t m_mapping_length;
+  TraceHeader *m_header;
+  TraceRecord *m_records;
+  uint64_t m_mask;
+
+  void close();
+
+public:
+  TraceBuffer();
+  ~TraceBuffer();
+  TraceBuffer(const TraceBuffer &) = delete;
+  auto operator=(const TraceBuffer &) -> TraceBuffer & = delete;
+
+  // Creates or truncates the file, capacity is in records and rounded up to
+  // a power of two
+  auto open(const std::filesystem::path &path, size_t capacity) -> bool;
+  [[nodiscard]] auto is_open() const -> bool { return m_header != nullptr; }
+
+  void record(const TraceRecord &record) {
+    m_records[m_header->written & m_mask] = record;
+    m_header->written++;
+  }
+
+  // Records in a trace file, oldest first, skipped counts the ones that
+  // were overwritten. Extension records are included as they were written
+  static auto load(const std::filesystem::path &path,
+                   std::vector<TraceRecord> &records, uint64_t &skipped)
+      -> bool;
+};
+}; // namespace Sakura
+
+#endif
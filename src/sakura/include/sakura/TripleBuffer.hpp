@@ -0,0 +1,51 @@
+#ifndef SAKURA_TRIPLE_BUFFER_HPP
+#define SAKURA_TRIPLE_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Sakura {
+
+/*
+Single producer, single consumer exchange of the latest value. The producer
+writes into back() and publishes it, the consumer picks up the most recently
+published buffer, older ones are dropped. Neither side ever waits for the
+other, they only swap indexes with the shared middle buffer.
+*/
+template <typename T> class TripleBuffer {
+private:
+  static constexpr uint8_t INDEX_MASK = 0b011;
+  static constexpr uint8_t FRESH = 0b100;
+
+  std::array<T, 3> m_buffers;
+  std::atomic<uint8_t> m_middle;
+  uint8_t m_back;
+  uint8_t m_front;
+
+public:
+  TripleBuffer() : m_buffers(), m_middle(1), m_back(0), m_front(2) {}
+  ~TripleBuffer() = default;
+
+  TripleBuffer(const TripleBuffer &) = delete;
+  auto operator=(const TripleBuffer &) -> TripleBuffer & = delete;
+
+  auto back() -> T & { return m_buffers[m_back]; }
+  void publish() {
+    m_back = m_middle.exchange(m_back | FRESH, std::memory_order_acq_rel) &
+             INDEX_MASK;
+  }
+
+  auto consume() -> bool {
+    if ((m_middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+      return false;
+    }
+    m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) &
+              INDEX_MASK;
+    return true;
+  }
+  [[nodiscard]] auto front() const -> const T & { return m_buffers[m_front]; }
+};
+}; // namespace Sakura
+
+#endif
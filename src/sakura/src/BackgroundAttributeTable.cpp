@@ -0,0 +1,46 @@
+#include "BackgroundAttributeTable.hpp"
+#include <sakura/Constants.hpp>
+
+using namespace Sakura::HuC6270;
+
+BackgroundAttributeTableFetcher::BackgroundAttributeTableFetcher()
+    : m_columns_shift(), m_column_mask(), m_row_mask() {
+  configure(0);
+}
+
+auto BackgroundAttributeTableFetcher::configure(uint8_t screen) -> bool {
+  // MWR bits 4-5 select 32, 64 or 128 columns, bit 6 selects 32 or 64 rows
+  unsigned int columns_shift = 7;
+  if ((screen & 0b011) == 0b000) {
+    columns_shift = 5;
+  } else if ((screen & 0b011) == 0b001) {
+    columns_shift = 6;
+  }
+  unsigned int rows_shift = (screen & 0b100) != 0 ? 6 : 5;
+
+  unsigned int column_mask = (1U << columns_shift) - 1;
+  unsigned int row_mask = (1U << rows_shift) - 1;
+  bool changed = column_mask != m_column_mask || row_mask != m_row_mask;
+  m_columns_shift = columns_shift;
+  m_column_mask = column_mask;
+  m_row_mask = row_mask;
+  return changed;
+}
+
+auto BackgroundAttributeTableFetcher::fetch(
+    const std::array<uint16_t, 0x8000> &vram, unsigned int column,
+    unsigned int row) const -> Character {
+  return {vram[get_address(column, row)]};
+}
+
+void BackgroundAttributeTableFetcher::fetch_line(
+    const std::array<uint16_t, 0x8000> &vram, unsigned int x, unsigned int y,
+    Character *characters, unsigned int count) const {
+  unsigned int column = x / CHARACTER_DOTS_WIDTH;
+  uint16_t row_address = (((y / CHARACTER_DOTS_HEIGHT) & m_row_mask)
+                          << m_columns_shift);
+  for (unsigned int i = 0; i < count; i++) {
+    characters[i] =
+        Character(vram[row_address | ((column + i) & m_column_mask)]);
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef SAKURA_BACKGROUND_ATTRIBUTE_TABLE_HPP
+#define SAKURA_BACKGROUND_ATTRIBUTE_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace Sakura::HuC6270 {
+
+union Character {
+  struct {
+    uint16_t code : 12;
+    uint16_t cg_color : 4;
+  };
+  uint16_t value;
+
+  Character() : value() {}
+  Character(uint16_t data) : value(data) {}
+};
+
+class BackgroundAttributeTableFetcher {
+private:
+  unsigned int m_columns_shift;
+  unsigned int m_column_mask;
+  unsigned int m_row_mask;
+
+public:
+  BackgroundAttributeTableFetcher();
+  ~BackgroundAttributeTableFetcher() = default;
+
+  auto configure(uint8_t screen) -> bool;
+
+  [[nodiscard]] auto get_columns() const -> unsigned int {
+    return m_column_mask + 1;
+  }
+  [[nodiscard]] auto get_rows() const -> unsigned int { return m_row_mask + 1; }
+  [[nodiscard]] auto get_address(unsigned int column, unsigned int row) const
+      -> uint16_t {
+    return ((row & m_row_mask) << m_columns_shift) | (column & m_column_mask);
+  }
+
+  [[nodiscard]] auto fetch(const std::array<uint16_t, 0x8000> &vram,
+                           unsigned int column, unsigned int row) const
+      -> Character;
+  void fetch_line(const std::array<uint16_t, 0x8000> &vram, unsigned int x,
+                  unsigned int y, Character *characters,
+                  unsigned int count) const;
+};
+}; // namespace Sakura::HuC6270
+
+#endif
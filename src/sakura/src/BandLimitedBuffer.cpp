@@ -0,0 +1,142 @@
+#include "BandLimitedBuffer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace Sakura::HuC6280::ProgrammableSoundGenerator;
+
+const double G_PI = 3.14159265358979323846;
+// Fraction of the output Nyquist frequency let through by the kernel
+const double G_CUTOFF = 0.9;
+// Removes the DC offset left by the unipolar channel outputs
+const float G_HIGH_PASS = 1.0F / 1024;
+const float G_INT16_SCALE = 32767.0F;
+const double G_MAX_RATIO_DEVIATION = 0.02;
+
+BandLimitedBuffer::BandLimitedBuffer()
+    : m_kernel(), m_base_factor(), m_factor(), m_offset(), m_left_accumulator(),
+      m_right_accumulator() {
+  const int half_width = BAND_LIMITED_STEP_WIDTH / 2;
+  for (unsigned int phase = 0; phase < BAND_LIMITED_STEP_PHASES; phase++) {
+    double fraction = static_cast<double>(phase) / BAND_LIMITED_STEP_PHASES;
+    std::array<double, BAND_LIMITED_STEP_WIDTH> taps = {};
+    double sum = 0.0;
+    for (unsigned int tap = 0; tap < BAND_LIMITED_STEP_WIDTH; tap++) {
+      double x = static_cast<int>(tap) - (half_width - 1) - fraction;
+      double sinc = x == 0.0 ? 1.0
+                             : std::sin(G_PI * G_CUTOFF * x) /
+                                   (G_PI * G_CUTOFF * x);
+      double window = 0.42 + 0.5 * std::cos(G_PI * x / half_width) +
+                      0.08 * std::cos(2.0 * G_PI * x / half_width);
+      taps[tap] = sinc * window;
+      sum += taps[tap];
+    }
+    // Each phase adds exactly the delta once integrated
+    for (unsigned int tap = 0; tap < BAND_LIMITED_STEP_WIDTH; tap++) {
+      m_kernel[phase][tap * 2] = static_cast<float>(taps[tap] / sum);
+      m_kernel[phase][tap * 2 + 1] = static_cast<float>(taps[tap] / sum);
+    }
+  }
+}
+
+void BandLimitedBuffer::configure(uint64_t clock_rate, unsigned int sample_rate,
+                                  unsigned int max_clocks) {
+  m_base_factor =
+      ((static_cast<uint64_t>(sample_rate) << 32) + clock_rate / 2) /
+      clock_rate;
+  m_factor = m_base_factor;
+  m_offset = 0;
+  m_left_accumulator = 0.0F;
+  m_right_accumulator = 0.0F;
+  unsigned int max_samples =
+      (static_cast<uint64_t>(max_clocks) * sample_rate) / clock_rate *
+          (1.0 + G_MAX_RATIO_DEVIATION) +
+      1;
+  m_buffer.assign((max_samples + BAND_LIMITED_STEP_WIDTH + 1) * 2, 0.0F);
+}
+
+void BandLimitedBuffer::set_ratio(double ratio) {
+  ratio = std::clamp(ratio, 1.0 - G_MAX_RATIO_DEVIATION,
+                     1.0 + G_MAX_RATIO_DEVIATION);
+  m_factor = static_cast<uint64_t>(static_cast<double>(m_base_factor) * ratio);
+}
+
+void BandLimitedBuffer::add_delta(uint32_t time, float left, float right) {
+  uint64_t position = m_offset + time * m_factor;
+  unsigned int phase = (position >> (32 - BAND_LIMITED_STEP_PHASE_BITS)) &
+                       (BAND_LIMITED_STEP_PHASES - 1);
+  float *buffer = &m_buffer[(position >> 32) * 2];
+  const float *kernel = m_kernel[phase].data();
+#if defined(__SSE2__)
+  __m128 delta = _mm_setr_ps(left, right, left, right);
+  for (unsigned int i = 0; i < BAND_LIMITED_STEP_WIDTH * 2; i += 4) {
+    __m128 taps = _mm_loadu_ps(kernel + i);
+    __m128 samples = _mm_loadu_ps(buffer + i);
+    _mm_storeu_ps(buffer + i, _mm_add_ps(samples, _mm_mul_ps(taps, delta)));
+  }
+#else
+  for (unsigned int i = 0; i < BAND_LIMITED_STEP_WIDTH * 2; i += 2) {
+    buffer[i] += kernel[i] * left;
+    buffer[i + 1] += kernel[i + 1] * right;
+  }
+#endif
+}
+
+void BandLimitedBuffer::end_block(uint32_t time) {
+  m_offset += time * m_factor;
+}
+
+void BandLimitedBuffer::integrate(unsigned int count, float *samples) {
+  float left = m_left_accumulator;
+  float right = m_right_accumulator;
+  for (unsigned int i = 0; i < count; i++) {
+    left += m_buffer[i * 2];
+    right += m_buffer[i * 2 + 1];
+    samples[i * 2] = left;
+    samples[i * 2 + 1] = right;
+    left -= left * G_HIGH_PASS;
+    right -= right * G_HIGH_PASS;
+  }
+  m_left_accumulator = left;
+  m_right_accumulator = right;
+}
+
+void BandLimitedBuffer::remove_samples(unsigned int count) {
+  // The kernels of the latest deltas spill past the last complete sample
+  unsigned int remaining =
+      (get_samples_available() - count + BAND_LIMITED_STEP_WIDTH + 1) * 2;
+  std::memmove(m_buffer.data(), m_buffer.data() + count * 2,
+               remaining * sizeof(float));
+  std::fill(m_buffer.begin() + remaining,
+            m_buffer.begin() + remaining + count * 2, 0.0F);
+  m_offset -= static_cast<uint64_t>(count) << 32;
+}
+
+void BandLimitedBuffer::read_samples(float *samples, unsigned int count) {
+  integrate(count, samples);
+  remove_samples(count);
+}
+
+void BandLimitedBuffer::convert_samples(const float *samples,
+                                        int16_t *output, unsigned int count) {
+  unsigned int i = 0;
+#if defined(__SSE2__)
+  __m128 scale = _mm_set1_ps(G_INT16_SCALE);
+  for (; i + 8 <= count; i += 8) {
+    __m128i low =
+        _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(samples + i), scale));
+    __m128i high =
+        _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(samples + i + 4), scale));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i),
+                     _mm_packs_epi32(low, high));
+  }
+#endif
+  for (; i < count; i++) {
+    float sample =
+        std::clamp(samples[i] * G_INT16_SCALE, -32768.0F, G_INT16_SCALE);
+    output[i] = static_cast<int16_t>(std::lround(sample));
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef SAKURA_BAND_LIMITED_BUFFER_HPP
+#define SAKURA_BAND_LIMITED_BUFFER_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Sakura::HuC6280::ProgrammableSoundGenerator {
+
+const unsigned int BAND_LIMITED_STEP_PHASE_BITS = 5;
+const unsigned int BAND_LIMITED_STEP_PHASES = 1
+                                              << BAND_LIMITED_STEP_PHASE_BITS;
+const unsigned int BAND_LIMITED_STEP_WIDTH = 16;
+
+/*
+Resamples a stereo signal made of steps from the input clock down to the host
+sample rate. Every change in amplitude is added as a delta filtered by a
+windowed sinc at its sub-sample position, the output is the running sum of
+those deltas. Only changes cost time so the PSG is never stepped at its
+native rate. Kernel taps are stored twice (left, right) so a delta is added
+four floats at a time.
+*/
+class BandLimitedBuffer {
+private:
+  std::array<std::array<float, BAND_LIMITED_STEP_WIDTH * 2>,
+             BAND_LIMITED_STEP_PHASES>
+      m_kernel;
+  // Interleaved stereo deltas
+  std::vector<float> m_buffer;
+  // Samples per clock and the start of the current block, 32.32 fixed point
+  uint64_t m_base_factor;
+  uint64_t m_factor;
+  uint64_t m_offset;
+  float m_left_accumulator;
+  float m_right_accumulator;
+
+  void integrate(unsigned int count, float *samples);
+  void remove_samples(unsigned int count);
+
+public:
+  BandLimitedBuffer();
+  ~BandLimitedBuffer() = default;
+
+  void configure(uint64_t clock_rate, unsigned int sample_rate,
+                 unsigned int max_clocks);
+  // Scales the sample rate by ratio, clamped to 2% either way
+  void set_ratio(double ratio);
+  // time is in clocks since the start of the current block
+  void add_delta(uint32_t time, float left, float right);
+  void end_block(uint32_t time);
+  [[nodiscard]] auto get_samples_available() const -> unsigned int {
+    return m_offset >> 32;
+  }
+  // Reads interleaved stereo samples and removes them from the buffer
+  void read_samples(float *samples, unsigned int count);
+
+  // count is the number of values, not of stereo samples
+  static void convert_samples(const float *samples, int16_t *output,
+                              unsigned int count);
+};
+}; // namespace Sakura::HuC6280::ProgrammableSoundGenerator
+
+#endif
@@ -0,0 +1,205 @@
+#include "sakura/CallProfiler.hpp"
+#include <algorithm>
+#include <fmt/core.h>
+#include <map>
+#include <utility>
+
+using namespace Sakura;
+
+const uint32_t G_NO_NODE = UINT32_MAX;
+const uint32_t G_ROOT = 0;
+
+auto FUNCTION_NAME(uint32_t physical_address, CallType type) -> std::string {
+  return fmt::format("{:02X}:{:04X}{}", physical_address >> 13,
+                     physical_address & 0x1FFF,
+                     type == CallType::Interrupt ? " [irq]" : "");
+}
+
+CallProfiler::CallProfiler(size_t max_depth, size_t max_nodes)
+    : m_max_nodes(std::max<size_t>(max_nodes, 1)),
+      m_stack(std::max<size_t>(max_depth, 1)), m_depth(), m_untracked_depth(),
+      m_current(G_ROOT), m_dropped_calls() {
+  m_nodes.reserve(m_max_nodes);
+  clear();
+}
+
+void CallProfiler::enter(uint32_t physical_address, CallType type) {
+  if (m_depth == m_stack.size()) {
+    m_untracked_depth++;
+    m_dropped_calls++;
+    return;
+  }
+  uint32_t child = m_nodes[m_current].first_child;
+  while (child != G_NO_NODE && (m_nodes[child].physical_address !=
+                                    physical_address ||
+                                m_nodes[child].type != type)) {
+    child = m_nodes[child].next_sibling;
+  }
+  if (child == G_NO_NODE && m_nodes.size() == m_max_nodes) {
+    // Pushed anyway so the return still matches
+    child = m_current;
+    m_dropped_calls++;
+  } else if (child == G_NO_NODE) {
+    child = m_nodes.size();
+    m_nodes.push_back({.physical_address = physical_address,
+                       .type = type,
+                       .parent = m_current,
+                       .first_child = G_NO_NODE,
+                       .next_sibling = m_nodes[m_current].first_child,
+                       .calls = 0,
+                       .exclusive_cycles = 0});
+    m_nodes[m_current].first_child = child;
+  }
+  if (child != m_current) {
+    m_nodes[child].calls++;
+  }
+  m_stack[m_depth++] = {.node = child, .type = type};
+  m_current = child;
+}
+
+void CallProfiler::leave(CallType type) {
+  if (m_untracked_depth > 0) {
+    m_untracked_depth--;
+    return;
+  }
+  if (type == CallType::Subroutine) {
+    if (m_depth == 0 || m_stack[m_depth - 1].type != CallType::Subroutine) {
+      return;
+    }
+    m_depth--;
+  } else {
+    // Subroutines the handler left without returning are unwound as well
+    size_t depth = m_depth;
+    while (depth > 0 && m_stack[depth - 1].type != CallType::Interrupt) {
+      depth--;
+    }
+    if (depth == 0) {
+      return;
+    }
+    m_depth = depth - 1;
+  }
+  m_current = m_depth == 0 ? G_ROOT : m_stack[m_depth - 1].node;
+}
+
+void CallProfiler::clear() {
+  m_nodes.clear();
+  m_nodes.push_back({.physical_address = 0,
+                     .type = CallType::Subroutine,
+                     .parent = G_NO_NODE,
+                     .first_child = G_NO_NODE,
+                     .next_sibling = G_NO_NODE,
+                     .calls = 0,
+                     .exclusive_cycles = 0});
+  m_depth = 0;
+  m_untracked_depth = 0;
+  m_current = G_ROOT;
+  m_dropped_calls = 0;
+}
+
+auto CallProfiler::get_frame_name(uint32_t node) const -> std::string {
+  if (node == G_ROOT) {
+    return "root";
+  }
+  return FUNCTION_NAME(m_nodes[node].physical_address, m_nodes[node].type);
+}
+
+auto CallProfiler::get_folded_stacks() const -> std::string {
+  std::string folded;
+  for (uint32_t node = 0; node < m_nodes.size(); node++) {
+    if (m_nodes[node].exclusive_cycles == 0) {
+      continue;
+    }
+    std::vector<uint32_t> path;
+    for (uint32_t entry = node; entry != G_NO_NODE;
+         entry = m_nodes[entry].parent) {
+      path.push_back(entry);
+    }
+    std::string line;
+    for (auto entry = path.rbegin(); entry != path.rend(); ++entry) {
+      line += (line.empty() ? "" : ";") + get_frame_name(*entry);
+    }
+    folded += fmt::format("{} {}\n", line, m_nodes[node].exclusive_cycles);
+  }
+  return folded;
+}
+
+auto CallProfiler::get_functions() const -> std::vector<CallProfileFunction> {
+  // Children are always allocated after their parents
+  std::vector<uint64_t> inclusive_cycles(m_nodes.size());
+  for (size_t node = m_nodes.size(); node-- > 0;) {
+    inclusive_cycles[node] += m_nodes[node].exclusive_cycles;
+    if (m_nodes[node].parent != G_NO_NODE) {
+      inclusive_cycles[m_nodes[node].parent] += inclusive_cycles[node];
+    }
+  }
+
+  std::map<std::pair<CallType, uint32_t>, CallProfileFunction> functions;
+  for (uint32_t node = 1; node < m_nodes.size(); node++) {
+    const Node &entry = m_nodes[node];
+    auto key = std::make_pair(entry.type, entry.physical_address);
+    auto function =
+        functions
+            .try_emplace(key, CallProfileFunction{
+                                  .physical_address = entry.physical_address,
+                                  .type = entry.type,
+                                  .calls = 0,
+                                  .inclusive_cycles = 0,
+                                  .exclusive_cycles = 0})
+            .first;
+    function->second.calls += entry.calls;
+    function->second.exclusive_cycles += entry.exclusive_cycles;
+    bool recursive = false;
+    for (uint32_t ancestor = entry.parent; ancestor != G_ROOT;
+         ancestor = m_nodes[ancestor].parent) {
+      if (m_nodes[ancestor].type == entry.type &&
+          m_nodes[ancestor].physical_address == entry.physical_address) {
+        recursive = true;
+        break;
+      }
+    }
+    if (!recursive) {
+      function->second.inclusive_cycles += inclusive_cycles[node];
+    }
+  }
+
+  std::vector<CallProfileFunction> sorted;
+  sorted.reserve(functions.size());
+  for (const auto &[key, function] : functions) {
+    sorted.push_back(function);
+  }
+  std::stable_sort(
+      sorted.begin(), sorted.end(),
+      [](const CallProfileFunction &a, const CallProfileFunction &b) {
+        return a.inclusive_cycles > b.inclusive_cycles;
+      });
+  return sorted;
+}
+
+auto CallProfiler::get_report(size_t count) const -> std::string {
+  uint64_t total_cycles = 0;
+  for (const auto &node : m_nodes) {
+    total_cycles += node.exclusive_cycles;
+  }
+  auto share = [=](uint64_t cycles) {
+    return total_cycles == 0 ? 0.0
+                             : static_cast<double>(cycles) /
+                                   static_cast<double>(total_cycles) * 100.0;
+  };
+  std::string report =
+      fmt::format("{} cycles, {} calls dropped\n", total_cycles,
+                  m_dropped_calls);
+  report += fmt::format("{:<14} {:>10} {:>14} {:>7} {:>14} {:>7}\n",
+                        "function", "calls", "inclusive", "%", "exclusive",
+                        "%");
+  std::vector<CallProfileFunction> functions = get_functions();
+  functions.resize(std::min(count, functions.size()));
+  for (const auto &function : functions) {
+    report += fmt::format(
+        "{:<14} {:>10} {:>14} {:>6.2f}% {:>14} {:>6.2f}%\n",
+        FUNCTION_NAME(function.physical_address, function.type),
+        function.calls, function.inclusive_cycles,
+        share(function.inclusive_cycles), function.exclusive_cycles,
+        share(function.exclusive_cycles));
+  }
+  return report;
+}
@@ -2,12 +2,33 @@
 #include "Disassembler_Impl.hpp"
 #include "Instructions.hpp"
 #include "Processor.hpp"
+#include "sakura/TraceBuffer.hpp"
+#include <algorithm>
+#include <array>
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
 #include <sstream>
+#include <vector>
 
 using namespace Sakura::HuC6280;
 
+// Mnemonic padded to a column, followed by the bytes of the instruction.
+// Bytes past the ones known are elided
+auto FORMAT_INSTRUCTION(const std::string &mnemonic,
+                        const std::vector<uint8_t> &bytes, uint8_t length)
+    -> std::string {
+  std::stringstream machine_code = std::stringstream();
+  machine_code << "; ";
+  for (size_t i = 0; i < bytes.size() && i < length; i++) {
+    machine_code << fmt::format(i == 0 ? "{:02X}" : " {:02X}", bytes[i]);
+  }
+  if (length > bytes.size()) {
+    machine_code << " ..";
+  }
+  std::string separator(40 - std::min<size_t>(mnemonic.length(), 39), ' ');
+  return fmt::format("{:s}{:s}{:s}", mnemonic, separator, machine_code.str());
+}
+
 Disassembler::Disassembler(std::unique_ptr<Processor> &processor)
     : m_processor(processor) {}
 
@@ -25,19 +46,105 @@ void Disassembler::disassemble(uint8_t opcode) {
                                previous_program_counter().c_str(), opcode));
     exit(1); // NOLINT(concurrency-mt-unsafe)
   }
+  // Formatting every instruction is expensive, skip it unless it's going to
+  // be logged
+  if (!spdlog::get(DISASSEMBLER_LOGGER_NAME)
+           ->should_log(spdlog::level::debug)) {
+    return;
+  }
   Disassembled instruction = handler(m_processor, opcode);
-  std::stringstream machine_code = std::stringstream();
-  machine_code << "; ";
-  machine_code << fmt::format("{:02X}", opcode);
+  std::vector<uint8_t> bytes = {opcode};
   for (uint8_t i = 0; i < instruction.length - 1; i++) {
-    uint8_t byte = m_processor->m_mapping_controller->load(
-        m_processor->m_registers.program_counter.value + i);
-    machine_code << fmt::format(" {:02X}", byte);
-  }
-  std::string separator(40 - instruction.mnemonic.length(), ' ');
-  std::string message =
-      fmt::format("{:s}: {:s}{:s}{:s}", previous_program_counter().c_str(),
-                  instruction.mnemonic.c_str(), separator.c_str(),
-                  machine_code.str().c_str());
+    bytes.push_back(m_processor->m_mapping_controller->peek(
+        m_processor->m_registers.program_counter.value + i));
+  }
+  std::string message = fmt::format(
+      "{:s}: {:s}", previous_program_counter(),
+      FORMAT_INSTRUCTION(instruction.mnemonic, bytes, instruction.length));
   spdlog::get(DISASSEMBLER_LOGGER_NAME)->debug(message);
 }
+
+auto Disassembler::disassemble_at(uint32_t physical_address,
+                                  uint16_t logical_address) -> std::string {
+  uint8_t bank = physical_address >> 13;
+  bool rom = bank <= 0x7F;
+  bool ram = bank >= 0xF8 && bank <= 0xFB;
+  if (!rom && !ram) {
+    return "(outside ROM and RAM)";
+  }
+  auto &mapping_controller = m_processor->m_mapping_controller;
+  uint8_t register_index = logical_address >> 13;
+  uint8_t mapped_bank = mapping_controller->mapping_register(register_index);
+  Registers registers = m_processor->m_registers;
+
+  mapping_controller->set_mapping_register(register_index, bank);
+  uint8_t opcode = mapping_controller->peek(logical_address);
+  InstructionHandler<Disassembled> handler =
+      INSTRUCTION_TABLE<Disassembled>[opcode];
+  std::string mnemonic = fmt::format(".db {:#04x}", opcode);
+  if (handler != nullptr) {
+    m_processor->m_registers.program_counter.value = logical_address + 1;
+    mnemonic = handler(m_processor, opcode).mnemonic;
+  }
+
+  m_processor->m_registers = registers;
+  mapping_controller->set_mapping_register(register_index, mapped_bank);
+  return mnemonic;
+}
+
+auto Disassembler::disassemble_record(const TraceRecord &record,
+                                      const TraceRecord *extension)
+    -> std::string {
+  std::vector<uint8_t> bytes = {record.opcode};
+  bytes.insert(bytes.end(), record.operands.begin(), record.operands.end());
+  if (extension != nullptr) {
+    bytes.insert(bytes.end(), extension->operands.begin(),
+                 extension->operands.end());
+  }
+  InstructionHandler<Disassembled> handler =
+      INSTRUCTION_TABLE<Disassembled>[record.opcode];
+  if (handler == nullptr) {
+    return FORMAT_INSTRUCTION(fmt::format(".db {:#04x}", record.opcode), bytes,
+                              1);
+  }
+
+  // The bytes are copied to RAM mapped at the traced address, the
+  // instruction may run into the next page
+  auto &mapping_controller = m_processor->m_mapping_controller;
+  uint16_t address = record.program_counter;
+  std::array<uint8_t, 2> register_indexes = {
+      static_cast<uint8_t>(address >> 13),
+      static_cast<uint8_t>(
+          static_cast<uint16_t>(address + bytes.size() - 1) >> 13)};
+  std::array<uint8_t, 2> mapped_banks = {};
+  for (size_t i = 0; i < register_indexes.size(); i++) {
+    mapped_banks[i] = mapping_controller->mapping_register(register_indexes[i]);
+  }
+  for (uint8_t register_index : register_indexes) {
+    mapping_controller->set_mapping_register(register_index, 0xF8);
+  }
+  std::vector<uint8_t> ram(bytes.size());
+  for (uint16_t i = 0; i < ram.size(); i++) {
+    ram[i] = mapping_controller->peek(address + i);
+    mapping_controller->poke(address + i, bytes[i]);
+  }
+  Registers registers = m_processor->m_registers;
+  m_processor->m_registers.accumulator = record.accumulator;
+  m_processor->m_registers.x = record.x;
+  m_processor->m_registers.y = record.y;
+  m_processor->m_registers.stack_pointer = record.stack_pointer;
+  m_processor->m_registers.status.value = record.status;
+  m_processor->m_registers.program_counter.value = address + 1;
+
+  Disassembled instruction = handler(m_processor, record.opcode);
+
+  m_processor->m_registers = registers;
+  for (uint16_t i = 0; i < ram.size(); i++) {
+    mapping_controller->poke(address + i, ram[i]);
+  }
+  for (size_t i = register_indexes.size(); i-- > 0;) {
+    mapping_controller->set_mapping_register(register_indexes[i],
+                                             mapped_banks[i]);
+  }
+  return FORMAT_INSTRUCTION(instruction.mnemonic, bytes, instruction.length);
+}
@@ -1,7 +1,13 @@
 #ifndef SAKURA_DISASSEMBLER_HPP
 #define SAKURA_DISASSEMBLER_HPP
 
+#include <cstdint>
 #include <memory>
+#include <string>
+
+namespace Sakura {
+struct TraceRecord;
+}; // namespace Sakura
 
 namespace Sakura::HuC6280 {
 class Processor;
@@ -18,7 +24,18 @@ public:
   Disassembler(std::unique_ptr<Processor> &processor);
   ~Disassembler() = default;
 
+  // Memory is only peeked at, hardware registers show as 0xFF rather than
+  // being read, so disassembling never changes the emulated state
   void disassemble(uint8_t opcode);
+  // Instruction at a physical address in ROM or RAM, decoded as if mapped
+  // at logical_address. Operand values shown are the current ones
+  auto disassemble_at(uint32_t physical_address, uint16_t logical_address)
+      -> std::string;
+  // Instruction of a trace, decoded with the traced registers. Memory
+  // operands show current values, not the ones at the time of the trace.
+  // Extension is null unless the instruction has one
+  auto disassemble_record(const TraceRecord &record,
+                          const TraceRecord *extension) -> std::string;
 };
 }; // namespace Sakura::HuC6280
 
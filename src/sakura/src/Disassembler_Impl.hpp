@@ -31,7 +31,7 @@ template <>
 auto Sakura::HuC6280::LDA_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("LDA #{:#04x}", imm), .length = 2};
 }
@@ -40,7 +40,7 @@ template <>
 auto Sakura::HuC6280::TAM_I(std::unique_ptr<Processor> &processor,
                             uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   int bit_position = Common::Bits::test_power_of_2(imm);
@@ -52,13 +52,13 @@ template <>
 auto Sakura::HuC6280::LDA_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDA {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -69,7 +69,7 @@ template <>
 auto Sakura::HuC6280::AND_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("AND #{:#04x}", imm), .length = 2};
 }
@@ -78,7 +78,7 @@ template <>
 auto Sakura::HuC6280::BEQ(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BEQ {:#06x}", destination), .length = 2};
@@ -104,7 +104,7 @@ template <>
 auto Sakura::HuC6280::LDX_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("LDX #{:#04x}", imm), .length = 2};
 }
@@ -121,7 +121,7 @@ template <>
 auto Sakura::HuC6280::STA_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("STA {:#04x}", zp), .length = 2};
 }
@@ -130,9 +130,9 @@ template <>
 auto Sakura::HuC6280::STA_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -144,9 +144,9 @@ template <>
 auto Sakura::HuC6280::STZ_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -158,7 +158,7 @@ template <>
 auto Sakura::HuC6280::STZ_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("STZ {:#04x}", zp), .length = 2};
 }
@@ -167,24 +167,24 @@ template <>
 auto Sakura::HuC6280::TAI(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  uint8_t sl = processor->m_mapping_controller->load(
+  uint8_t sl = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint8_t sh = processor->m_mapping_controller->load(
+  uint8_t sh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
-  uint8_t dl = processor->m_mapping_controller->load(
+  uint8_t dl = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 2);
-  uint8_t dh = processor->m_mapping_controller->load(
+  uint8_t dh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 3);
 
-  uint8_t ll = processor->m_mapping_controller->load(
+  uint8_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 4);
-  uint8_t lh = processor->m_mapping_controller->load(
+  uint8_t lh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 5);
 
   return {.mnemonic =
-              fmt::format("TAI {:#04x}{:#04x}, {:#04x}{:#04x}, {:#04x}{:#04x}",
-                          sh, sl, dh, dl, lh, ll),
+              fmt::format("TAI {:#06x}, {:#06x}, {:#06x}", sh << 8 | sl,
+                          dh << 8 | dl, lh << 8 | ll),
           .length = 7};
 }
 
@@ -208,9 +208,9 @@ template <>
 auto Sakura::HuC6280::JSR(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -222,7 +222,7 @@ template <>
 auto Sakura::HuC6280::TMA_I(std::unique_ptr<Processor> &processor,
                             uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   int bit_position = Common::Bits::test_power_of_2(imm);
@@ -266,18 +266,18 @@ template <>
 auto Sakura::HuC6280::JMP_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
-  uint16_t destination = processor->m_mapping_controller->load(
+  uint16_t destination = processor->m_mapping_controller->peek(
       address + processor->m_registers.x + 1);
   destination <<= 8;
   destination |=
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic =
               fmt::format("JMP ({:#06x}, X)  {:#06x}", address, destination),
@@ -287,11 +287,11 @@ auto Sakura::HuC6280::JMP_ABS_X(std::unique_ptr<Processor> &processor,
 template <>
 auto Sakura::HuC6280::SMB_I(std::unique_ptr<Processor> &processor,
                             uint8_t opcode) -> Disassembled {
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   uint8_t index = opcode & 0x70;
   index >>= 4;
@@ -305,11 +305,11 @@ auto Sakura::HuC6280::SMB_I(std::unique_ptr<Processor> &processor,
 template <>
 auto Sakura::HuC6280::RMB_I(std::unique_ptr<Processor> &processor,
                             uint8_t opcode) -> Disassembled {
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   uint8_t index = opcode & 0x70;
   index >>= 4;
@@ -324,9 +324,9 @@ template <>
 auto Sakura::HuC6280::STX_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -346,7 +346,7 @@ template <>
 auto Sakura::HuC6280::BPL(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BPL {:#06x}", destination), .length = 2};
@@ -356,7 +356,7 @@ template <>
 auto Sakura::HuC6280::LDY_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("LDY #{:#04x}", imm), .length = 2};
 }
@@ -405,10 +405,10 @@ template <>
 auto Sakura::HuC6280::LDA_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("LDA {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -435,15 +435,15 @@ template <>
 auto Sakura::HuC6280::LDA_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("LDA {:#06x}, Y  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -454,9 +454,9 @@ template <>
 auto Sakura::HuC6280::STA_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -470,14 +470,14 @@ template <>
 auto Sakura::HuC6280::ORA_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("ORA {:#06x}, Y @{:#06x}={:#04x}", address,
                                   address + processor->m_registers.y, value),
@@ -488,7 +488,7 @@ template <>
 auto Sakura::HuC6280::EOR_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("EOR #{:#04x}", imm), .length = 2};
 }
@@ -497,14 +497,14 @@ template <>
 auto Sakura::HuC6280::EOR_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("EOR {:#06x}, Y @{:#06x}={:#04x}", address,
                                   address + processor->m_registers.y, value),
@@ -515,14 +515,14 @@ template <>
 auto Sakura::HuC6280::AND_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("AND {:#06x}, Y @{:#06x}={:#04x}", address,
                                   address + processor->m_registers.y, value),
@@ -541,7 +541,7 @@ template <>
 auto Sakura::HuC6280::CPY_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("CPY #{:#04x}", imm), .length = 2};
 }
@@ -550,7 +550,7 @@ template <>
 auto Sakura::HuC6280::BCC(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BCC {:#06x}", destination), .length = 2};
@@ -560,7 +560,7 @@ template <>
 auto Sakura::HuC6280::CMP_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("CMP #{:#04x}", imm), .length = 2};
 }
@@ -569,7 +569,7 @@ template <>
 auto Sakura::HuC6280::BNE(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BNE {:#06x}", destination), .length = 2};
@@ -587,15 +587,15 @@ template <>
 auto Sakura::HuC6280::LDA_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("LDA {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -614,7 +614,7 @@ template <>
 auto Sakura::HuC6280::CPX_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("CPX #{:#04x}", imm), .length = 2};
 }
@@ -623,7 +623,7 @@ template <>
 auto Sakura::HuC6280::ST0(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("ST0 #{:#04x}", imm), .length = 2};
 }
@@ -648,13 +648,13 @@ template <>
 auto Sakura::HuC6280::LDY_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDY {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -665,15 +665,15 @@ template <>
 auto Sakura::HuC6280::LDA_IND(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("LDA ({:#04x})  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -683,9 +683,9 @@ template <>
 auto Sakura::HuC6280::STA_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -699,16 +699,16 @@ template <>
 auto Sakura::HuC6280::LDA_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("LDA ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -726,7 +726,7 @@ template <>
 auto Sakura::HuC6280::ADC_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("ADC #{:#04x}", imm), .length = 2};
 }
@@ -735,9 +735,9 @@ template <>
 auto Sakura::HuC6280::STZ_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -751,11 +751,11 @@ template <>
 auto Sakura::HuC6280::CPX_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("CPX {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -774,7 +774,7 @@ template <>
 auto Sakura::HuC6280::SBC_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("SBC #{:#04x}", imm), .length = 2};
 }
@@ -791,7 +791,7 @@ template <>
 auto Sakura::HuC6280::ORA_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("ORA #{:#04x}", imm), .length = 2};
 }
@@ -808,9 +808,9 @@ template <>
 auto Sakura::HuC6280::JMP_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t destination = hh << 8 | ll;
@@ -822,7 +822,7 @@ template <>
 auto Sakura::HuC6280::BRA(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BRA {:#06x}", destination), .length = 2};
@@ -832,10 +832,10 @@ template <>
 auto Sakura::HuC6280::ORA_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("ORA {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -845,12 +845,12 @@ template <>
 auto Sakura::HuC6280::STA_IND(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   return {.mnemonic = fmt::format("STA ({:#04x})  @{:#06x}", zp, address),
@@ -861,12 +861,12 @@ template <>
 auto Sakura::HuC6280::STA_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
@@ -886,7 +886,7 @@ template <>
 auto Sakura::HuC6280::BCS(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BCS {:#06x}", destination), .length = 2};
@@ -896,10 +896,10 @@ template <>
 auto Sakura::HuC6280::ASL_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("ASL {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -909,10 +909,10 @@ template <>
 auto Sakura::HuC6280::ROL_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("ROL {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -922,10 +922,10 @@ template <>
 auto Sakura::HuC6280::ADC_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("ADC {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -935,13 +935,13 @@ template <>
 auto Sakura::HuC6280::ADC_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ADC {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -952,7 +952,7 @@ template <>
 auto Sakura::HuC6280::BSR(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BSR {:#06x}", destination), .length = 2};
@@ -962,7 +962,7 @@ template <>
 auto Sakura::HuC6280::BMI(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BMI {:#06x}", destination), .length = 2};
@@ -972,10 +972,10 @@ template <>
 auto Sakura::HuC6280::INC_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("INC {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -985,7 +985,7 @@ template <>
 auto Sakura::HuC6280::STA_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
@@ -998,7 +998,7 @@ template <>
 auto Sakura::HuC6280::STX_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("STX {:#04x}", zp), .length = 2};
 }
@@ -1007,11 +1007,11 @@ template <>
 auto Sakura::HuC6280::ASL_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("ASL {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -1021,10 +1021,10 @@ template <>
 auto Sakura::HuC6280::DEC_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("DEC {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -1034,10 +1034,10 @@ template <>
 auto Sakura::HuC6280::LSR_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("LSR {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -1063,10 +1063,10 @@ template <>
 auto Sakura::HuC6280::LDX_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("LDX {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -1077,13 +1077,13 @@ template <>
 auto Sakura::HuC6280::INC_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint16_t value = processor->m_mapping_controller->load(address);
+  uint16_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("INC {:#06x} @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1094,13 +1094,13 @@ template <>
 auto Sakura::HuC6280::LDX_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDX {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1111,10 +1111,10 @@ template <>
 auto Sakura::HuC6280::LDY_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("LDY {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -1140,16 +1140,16 @@ auto Sakura::HuC6280::RTI(std::unique_ptr<Processor> &processor, uint8_t opcode)
 template <>
 auto Sakura::HuC6280::BBR_I(std::unique_ptr<Processor> &processor,
                             uint8_t opcode) -> Disassembled {
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   uint8_t index = opcode & 0x70;
   index >>= 4;
 
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
   uint16_t destination = processor->m_registers.program_counter.value + 2 + imm;
 
@@ -1162,7 +1162,7 @@ template <>
 auto Sakura::HuC6280::BIT_IMM(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("BIT #{:#04x}", imm), .length = 2};
 }
@@ -1171,13 +1171,13 @@ template <>
 auto Sakura::HuC6280::CMP_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("CMP {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1188,24 +1188,24 @@ template <>
 auto Sakura::HuC6280::TIA(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  uint8_t sl = processor->m_mapping_controller->load(
+  uint8_t sl = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint8_t sh = processor->m_mapping_controller->load(
+  uint8_t sh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
-  uint8_t dl = processor->m_mapping_controller->load(
+  uint8_t dl = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 2);
-  uint8_t dh = processor->m_mapping_controller->load(
+  uint8_t dh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 3);
 
-  uint8_t ll = processor->m_mapping_controller->load(
+  uint8_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 4);
-  uint8_t lh = processor->m_mapping_controller->load(
+  uint8_t lh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 5);
 
   return {.mnemonic =
-              fmt::format("TIA {:#04x}{:#04x}, {:#04x}{:#04x}, {:#04x}{:#04x}",
-                          sh, sl, dh, dl, lh, ll),
+              fmt::format("TIA {:#06x}, {:#06x}, {:#06x}", sh << 8 | sl,
+                          dh << 8 | dl, lh << 8 | ll),
           .length = 7};
 }
 
@@ -1221,15 +1221,15 @@ template <>
 auto Sakura::HuC6280::ADC_IND(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("ADC ({:#04x})  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -1239,7 +1239,7 @@ template <>
 auto Sakura::HuC6280::STY_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("STY {:#04x}", zp), .length = 2};
 }
@@ -1248,11 +1248,11 @@ template <>
 auto Sakura::HuC6280::LDA_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDA {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1279,15 +1279,15 @@ template <>
 auto Sakura::HuC6280::ADC_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("ADC {:#06x}, Y  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1298,16 +1298,16 @@ template <>
 auto Sakura::HuC6280::JMP_ABS_IND(std::unique_ptr<Processor> &processor,
                                   uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
-  uint16_t destination = processor->m_mapping_controller->load(address + 1);
+  uint16_t destination = processor->m_mapping_controller->peek(address + 1);
   destination <<= 8;
-  destination |= processor->m_mapping_controller->load(address);
+  destination |= processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("JMP ({:#06x})  {:#06x}", address, destination),
@@ -1326,11 +1326,11 @@ template <>
 auto Sakura::HuC6280::DEC_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("DEC {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -1348,13 +1348,13 @@ template <>
 auto Sakura::HuC6280::DEC_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("DEC {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1365,14 +1365,14 @@ template <>
 auto Sakura::HuC6280::CMP_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint8_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("CMP {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1383,14 +1383,14 @@ template <>
 auto Sakura::HuC6280::INC_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.x;
-  uint16_t value = processor->m_mapping_controller->load(address);
+  uint16_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("INC {:#06x} @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1401,14 +1401,14 @@ template <>
 auto Sakura::HuC6280::DEC_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.x;
-  uint16_t value = processor->m_mapping_controller->load(address);
+  uint16_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("DEC {:#06x} @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1419,15 +1419,15 @@ template <>
 auto Sakura::HuC6280::ADC_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("ADC {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1438,14 +1438,14 @@ template <>
 auto Sakura::HuC6280::ORA_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("ORA {:#06x}, X @{:#06x}={:#04x}", address,
                                   address + processor->m_registers.x, value),
@@ -1456,7 +1456,7 @@ template <>
 auto Sakura::HuC6280::ST1(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("ST1 #{:#04x}", imm), .length = 2};
 }
@@ -1465,7 +1465,7 @@ template <>
 auto Sakura::HuC6280::ST2(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  uint8_t imm = processor->m_mapping_controller->load(
+  uint8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   return {.mnemonic = fmt::format("ST2 #{:#04x}", imm), .length = 2};
 }
@@ -1473,16 +1473,16 @@ auto Sakura::HuC6280::ST2(std::unique_ptr<Processor> &processor, uint8_t opcode)
 template <>
 auto Sakura::HuC6280::BBS_I(std::unique_ptr<Processor> &processor,
                             uint8_t opcode) -> Disassembled {
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   uint8_t index = opcode & 0x70;
   index >>= 4;
 
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
   uint16_t destination = processor->m_registers.program_counter.value + 2 + imm;
 
@@ -1495,9 +1495,9 @@ template <>
 auto Sakura::HuC6280::STY_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
@@ -1509,10 +1509,10 @@ template <>
 auto Sakura::HuC6280::TSB_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address) |
+  uint8_t value = processor->m_mapping_controller->peek(address) |
                   processor->m_registers.accumulator;
   return {.mnemonic =
               fmt::format("TSB {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -1523,13 +1523,13 @@ template <>
 auto Sakura::HuC6280::TRB_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint16_t value = processor->m_mapping_controller->load(address);
+  uint16_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("TRB {:#06x} @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1540,7 +1540,7 @@ template <>
 auto Sakura::HuC6280::BVC(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BVC {:#06x}", destination), .length = 2};
@@ -1550,7 +1550,7 @@ template <>
 auto Sakura::HuC6280::BVS(std::unique_ptr<Processor> &processor, uint8_t opcode)
     -> Disassembled {
   (void)opcode;
-  int8_t imm = processor->m_mapping_controller->load(
+  int8_t imm = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t destination = processor->m_registers.program_counter.value + 1 + imm;
   return {.mnemonic = fmt::format("BVS {:#06x}", destination), .length = 2};
@@ -1584,11 +1584,11 @@ template <>
 auto Sakura::HuC6280::LDX_ZP_Y(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.y;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDX {:#04x}, Y  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1599,14 +1599,14 @@ template <>
 auto Sakura::HuC6280::CMP_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("CMP {:#06x}, Y  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1617,15 +1617,15 @@ template <>
 auto Sakura::HuC6280::LDX_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("LDX {:#06x}, Y  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1636,7 +1636,7 @@ template <>
 auto Sakura::HuC6280::STX_ZP_Y(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.y;
   uint16_t address = processor->get_zero_page_address(zp);
@@ -1650,11 +1650,11 @@ template <>
 auto Sakura::HuC6280::LDY_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDY {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1665,15 +1665,15 @@ template <>
 auto Sakura::HuC6280::LDY_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("LDY {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1684,7 +1684,7 @@ template <>
 auto Sakura::HuC6280::STY_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
@@ -1698,11 +1698,11 @@ template <>
 auto Sakura::HuC6280::CMP_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("CMP {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1713,10 +1713,10 @@ template <>
 auto Sakura::HuC6280::CMP_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("CMP {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -1727,13 +1727,13 @@ template <>
 auto Sakura::HuC6280::CPX_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("CPX {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1744,10 +1744,10 @@ template <>
 auto Sakura::HuC6280::CPY_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("CPY {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -1758,13 +1758,13 @@ template <>
 auto Sakura::HuC6280::CPY_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("CPY {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1775,16 +1775,16 @@ template <>
 auto Sakura::HuC6280::CMP_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("CMP ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -1794,16 +1794,16 @@ template <>
 auto Sakura::HuC6280::LDA_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LDA ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1814,13 +1814,13 @@ template <>
 auto Sakura::HuC6280::STA_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   return {.mnemonic = fmt::format("STA ({:#04x}, X)  @{:#06x}={:#06x}", zp,
@@ -1832,10 +1832,10 @@ template <>
 auto Sakura::HuC6280::BIT_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("BIT {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -1845,13 +1845,13 @@ template <>
 auto Sakura::HuC6280::BIT_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("BIT {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
           .length = 3};
@@ -1861,16 +1861,16 @@ template <>
 auto Sakura::HuC6280::CMP_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("CMP ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1897,10 +1897,10 @@ template <>
 auto Sakura::HuC6280::ROR_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("ROR {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -1910,13 +1910,13 @@ template <>
 auto Sakura::HuC6280::ASL_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ASL {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1927,13 +1927,13 @@ template <>
 auto Sakura::HuC6280::LSR_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LSR {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1944,13 +1944,13 @@ template <>
 auto Sakura::HuC6280::ROL_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ROL {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1961,13 +1961,13 @@ template <>
 auto Sakura::HuC6280::ROR_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ROR {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -1978,12 +1978,12 @@ template <>
 auto Sakura::HuC6280::LSR_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("LSR {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -1994,12 +1994,12 @@ template <>
 auto Sakura::HuC6280::ROL_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ROL {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2010,12 +2010,12 @@ template <>
 auto Sakura::HuC6280::ROR_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ROR {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2026,15 +2026,15 @@ template <>
 auto Sakura::HuC6280::ASL_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("ASL {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2045,15 +2045,15 @@ template <>
 auto Sakura::HuC6280::LSR_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("LSR {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2064,15 +2064,15 @@ template <>
 auto Sakura::HuC6280::ROL_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("ROL {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2083,15 +2083,15 @@ template <>
 auto Sakura::HuC6280::ROR_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("ROR {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2102,11 +2102,11 @@ template <>
 auto Sakura::HuC6280::INC_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("INC {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2116,10 +2116,10 @@ template <>
 auto Sakura::HuC6280::AND_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic =
               fmt::format("AND {:#04x}  @{:#06x}={:#04x}", zp, address, value),
@@ -2130,13 +2130,13 @@ template <>
 auto Sakura::HuC6280::AND_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("AND {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2147,11 +2147,11 @@ template <>
 auto Sakura::HuC6280::AND_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("AND {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2162,14 +2162,14 @@ template <>
 auto Sakura::HuC6280::AND_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint8_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("AND {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2180,16 +2180,16 @@ template <>
 auto Sakura::HuC6280::AND_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("AND ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2200,16 +2200,16 @@ template <>
 auto Sakura::HuC6280::AND_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("AND ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2219,10 +2219,10 @@ template <>
 auto Sakura::HuC6280::EOR_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("EOR {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -2232,13 +2232,13 @@ template <>
 auto Sakura::HuC6280::EOR_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint16_t value = processor->m_mapping_controller->load(address);
+  uint16_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("EOR {:#06x} @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2249,11 +2249,11 @@ template <>
 auto Sakura::HuC6280::EOR_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("EOR {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2264,14 +2264,14 @@ template <>
 auto Sakura::HuC6280::EOR_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
   uint8_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("EOR {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2282,16 +2282,16 @@ template <>
 auto Sakura::HuC6280::EOR_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("EOR ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2302,16 +2302,16 @@ template <>
 auto Sakura::HuC6280::EOR_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("EOR ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2321,13 +2321,13 @@ template <>
 auto Sakura::HuC6280::ORA_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ORA {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2338,11 +2338,11 @@ template <>
 auto Sakura::HuC6280::ORA_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ORA {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2353,16 +2353,16 @@ template <>
 auto Sakura::HuC6280::ORA_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ORA ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2373,16 +2373,16 @@ template <>
 auto Sakura::HuC6280::ORA_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("ORA ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2392,10 +2392,10 @@ template <>
 auto Sakura::HuC6280::SBC_ZP(std::unique_ptr<Processor> &processor,
                              uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic =
               fmt::format("SBC {:#04x}  @{:#06x}={:#04x}", zp, address, value),
           .length = 2};
@@ -2405,13 +2405,13 @@ template <>
 auto Sakura::HuC6280::SBC_ABS(std::unique_ptr<Processor> &processor,
                               uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("SBC {:#06x}  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2422,11 +2422,11 @@ template <>
 auto Sakura::HuC6280::ADC_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("ADC {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2436,11 +2436,11 @@ template <>
 auto Sakura::HuC6280::SBC_ZP_X(std::unique_ptr<Processor> &processor,
                                uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
   uint16_t address = processor->get_zero_page_address(zp);
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("SBC {:#04x}, X  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2450,15 +2450,15 @@ template <>
 auto Sakura::HuC6280::SBC_ABS_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.x);
+      processor->m_mapping_controller->peek(address + processor->m_registers.x);
 
   return {.mnemonic = fmt::format("SBC {:#06x}, X  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2469,15 +2469,15 @@ template <>
 auto Sakura::HuC6280::SBC_ABS_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint16_t ll = processor->m_mapping_controller->load(
+  uint16_t ll = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
-  uint16_t hh = processor->m_mapping_controller->load(
+  uint16_t hh = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value + 1);
 
   uint16_t address = hh << 8 | ll;
 
   uint16_t value =
-      processor->m_mapping_controller->load(address + processor->m_registers.y);
+      processor->m_mapping_controller->peek(address + processor->m_registers.y);
 
   return {.mnemonic = fmt::format("SBC {:#06x}, Y  @{:#06x}={:#04x}", address,
                                   address, value),
@@ -2488,16 +2488,16 @@ template <>
 auto Sakura::HuC6280::ADC_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("ADC ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2508,16 +2508,16 @@ template <>
 auto Sakura::HuC6280::SBC_IND_X(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
   zp += processor->m_registers.x;
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
 
   return {.mnemonic = fmt::format("SBC ({:#04x}, X)  @{:#06x}={:#04x}", zp,
                                   address, value),
@@ -2528,16 +2528,16 @@ template <>
 auto Sakura::HuC6280::ADC_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("ADC ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
@@ -2547,16 +2547,16 @@ template <>
 auto Sakura::HuC6280::SBC_IND_Y(std::unique_ptr<Processor> &processor,
                                 uint8_t opcode) -> Disassembled {
   (void)opcode;
-  uint8_t zp = processor->m_mapping_controller->load(
+  uint8_t zp = processor->m_mapping_controller->peek(
       processor->m_registers.program_counter.value);
 
   uint16_t zp_address = processor->get_zero_page_address(zp);
-  uint16_t ll = processor->m_mapping_controller->load(zp_address);
-  uint16_t hh = processor->m_mapping_controller->load(zp_address + 1);
+  uint16_t ll = processor->m_mapping_controller->peek(zp_address);
+  uint16_t hh = processor->m_mapping_controller->peek(zp_address + 1);
 
   uint16_t address = hh << 8 | ll;
   address += processor->m_registers.y;
-  uint8_t value = processor->m_mapping_controller->load(address);
+  uint8_t value = processor->m_mapping_controller->peek(address);
   return {.mnemonic = fmt::format("SBC ({:#04x}), Y  @{:#06x}={:#04x}", zp,
                                   address, value),
           .length = 2};
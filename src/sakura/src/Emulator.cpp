@@ -4,12 +4,16 @@
 #include "Instructions.hpp"
 #include "Instructions_Impl.hpp"
 #include "Interrupt.hpp"
+#include "Machine.hpp"
 #include "Memory.hpp"
 #include "Processor.hpp"
 #include "ProgrammableSoundGenerator.hpp"
+#include "State.hpp"
 #include "Timer.hpp"
 #include "VideoColorEncoder.hpp"
 #include "VideoDisplayController.hpp"
+#include <common/Hash.hpp>
+#include <fmt/core.h>
 #include <memory>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -18,6 +22,46 @@
 
 using namespace Sakura;
 
+const uint32_t G_STATE_TAG = STATE_TAG("EMU ");
+
+const std::array<HuC6280::InstructionHandler<uint8_t>, 0x100>
+    &HuC6280::INTERPRETER_TABLE = HuC6280::INSTRUCTION_TABLE<uint8_t>;
+
+// Loggers are global, every emulator in the process shares them and the
+// latest configuration wins
+void REGISTER_LOGGER(const std::shared_ptr<spdlog::logger> &logger) {
+  spdlog::drop(logger->name());
+  spdlog::register_logger(logger);
+}
+
+// Loads every section of a snapshot into the given controllers, they are left
+// partially loaded when it fails
+auto LOAD_STATE_SECTIONS(
+    const std::vector<uint8_t> &state, uint64_t &executed_instructions,
+    uint64_t &executed_cycles, uint64_t &frame, HuC6280::Processor &processor,
+    HuC6280::Mapping::Controller &mapping_controller,
+    HuC6280::Interrupt::Controller &interrupt_controller,
+    HuC6260::Controller &video_color_encoder_controller,
+    HuC6270::Controller &video_display_controller,
+    HuC6280::ProgrammableSoundGenerator::Controller
+        &programmable_sound_generator_controller) -> bool {
+  StateReader reader(state);
+  if (!reader.is_valid()) {
+    return false;
+  }
+  reader.open_section(G_STATE_TAG);
+  reader.read(executed_instructions);
+  reader.read(executed_cycles);
+  reader.read(frame);
+  processor.load_state(reader);
+  mapping_controller.load_state(reader);
+  interrupt_controller.load_state(reader);
+  video_color_encoder_controller.load_state(reader);
+  video_display_controller.load_state(reader);
+  programmable_sound_generator_controller.load_state(reader);
+  return reader.is_valid();
+}
+
 Emulator::Emulator(const VDCConfig &vdc_config,
                    const MOS6502ModeConfig &mos_6502_mode_config)
     : m_interrupt_controller(
@@ -26,30 +70,187 @@ Emulator::Emulator(const VDCConfig &vdc_config,
       m_video_display_controller(std::make_unique<HuC6270::Controller>(
           vdc_config, m_interrupt_controller,
           m_video_color_encoder_controller)),
+      m_programmable_sound_generator_controller(
+          std::make_unique<HuC6280::ProgrammableSoundGenerator::Controller>()),
       m_mapping_controller(std::make_unique<HuC6280::Mapping::Controller>(
           mos_6502_mode_config, m_interrupt_controller,
-          m_video_color_encoder_controller, m_video_display_controller)),
+          m_video_color_encoder_controller, m_video_display_controller,
+          m_programmable_sound_generator_controller)),
       m_processor(std::make_unique<HuC6280::Processor>(
           mos_6502_mode_config, m_mapping_controller, m_interrupt_controller)),
       m_disassembler(std::make_unique<HuC6280::Disassembler>(m_processor)),
       m_renderer_info(std::make_unique<Sakura::RendererInfo>(
-          m_video_display_controller, m_video_color_encoder_controller)){};
+          m_video_display_controller, m_video_color_encoder_controller)),
+      m_opcode_profiler(std::make_unique<OpcodeProfiler>()),
+      m_should_pause(), m_executed_instructions(), m_executed_cycles(),
+      m_frame(), m_joypad_buttons(), m_input_movie_mode() {
+  m_video_display_controller->set_vsync_callback([this] { vsync(); });
+};
 
 Emulator::~Emulator() = default;
 
+void Emulator::step() {
+  uint8_t opcode = m_processor->fetch_instruction();
+  if (m_trace_buffer) {
+    trace(opcode);
+  }
+  HuC6280::InstructionHandler<uint8_t> handler =
+      HuC6280::INSTRUCTION_TABLE<uint8_t>[opcode];
+  m_disassembler->disassemble(opcode);
+#if defined(SAKURA_OPCODE_PROFILER)
+  uint8_t cycles = 0;
+  if (m_opcode_profiler->should_sample()) {
+    uint64_t ticks = OpcodeProfiler::read_ticks();
+    cycles = handler(m_processor, opcode);
+    m_opcode_profiler->record_sample(opcode,
+                                     OpcodeProfiler::read_ticks() - ticks);
+  } else {
+    cycles = handler(m_processor, opcode);
+  }
+  m_opcode_profiler->record(opcode, cycles);
+#else
+  uint8_t cycles = handler(m_processor, opcode);
+#endif
+  m_mapping_controller->step(cycles);
+  if (m_call_profiler) {
+    profile_call(opcode, cycles);
+  }
+  if (m_processor->check_interrupts() && m_call_profiler) {
+    m_call_profiler->enter(get_physical_program_counter(),
+                           CallType::Interrupt);
+  }
+  m_executed_instructions++;
+  m_executed_cycles += cycles;
+  if (m_pc_sampler && m_pc_sampler->step(cycles)) {
+    m_pc_sampler->sample(get_physical_program_counter(),
+                         m_processor->get_registers().program_counter.value);
+  }
+}
+
+void Emulator::trace(uint8_t opcode) {
+  const HuC6280::Registers &registers = m_processor->get_registers();
+  // The program counter is already past the opcode
+  uint16_t address = registers.program_counter.value - 1;
+  TraceRecord record = {
+      .cycle = static_cast<uint32_t>(m_executed_cycles),
+      .program_counter = address,
+      .bank = m_mapping_controller->mapping_register(address >> 13),
+      .opcode = opcode,
+      .operands = {m_mapping_controller->peek(address + 1),
+                   m_mapping_controller->peek(address + 2),
+                   m_mapping_controller->peek(address + 3)},
+      .accumulator = registers.accumulator,
+      .x = registers.x,
+      .y = registers.y,
+      .stack_pointer = registers.stack_pointer,
+      .status = registers.status.value};
+  switch (opcode) {
+  case 0x73: // TII
+  case 0xC3: // TDD
+  case 0xD3: // TIN
+  case 0xE3: // TIA
+  case 0xF3: { // TAI
+    // Written first, so the ring never keeps an extension without its
+    // instruction
+    TraceRecord extension = record;
+    extension.operands = {m_mapping_controller->peek(address + 4),
+                          m_mapping_controller->peek(address + 5),
+                          m_mapping_controller->peek(address + 6)};
+    m_trace_buffer->record(extension);
+    break;
+  }
+  default:
+    break;
+  }
+  m_trace_buffer->record(record);
+}
+
+void Emulator::profile_call(uint8_t opcode, uint8_t cycles) {
+  m_call_profiler->add_cycles(cycles);
+  switch (opcode) {
+  case 0x20: // JSR
+  case 0x44: // BSR
+    m_call_profiler->enter(get_physical_program_counter(),
+                           CallType::Subroutine);
+    break;
+  case 0x60: // RTS
+    m_call_profiler->leave(CallType::Subroutine);
+    break;
+  case 0x00: // BRK
+    m_call_profiler->enter(get_physical_program_counter(),
+                           CallType::Interrupt);
+    break;
+  case 0x40: // RTI
+    m_call_profiler->leave(CallType::Interrupt);
+    break;
+  default:
+    break;
+  }
+}
+
+auto Emulator::get_physical_program_counter() const -> uint32_t {
+  uint16_t logical_address =
+      m_processor->get_registers().program_counter.value;
+  uint32_t bank = m_mapping_controller->mapping_register(logical_address >> 13);
+  return bank << 13 | (logical_address & 0x1FFF);
+}
+
+void Emulator::vsync() {
+  m_frame++;
+  uint8_t buttons = m_joypad_buttons.load(std::memory_order_relaxed);
+  if (m_input_movie) {
+    if (m_input_movie_mode == InputMovieMode::Playback) {
+      buttons = m_input_movie->get_buttons(m_frame);
+    } else {
+      m_input_movie->record(m_frame, buttons);
+    }
+  }
+  m_mapping_controller->set_joypad_buttons(buttons);
+  if (m_vsync_callback) {
+    m_vsync_callback(m_renderer_info);
+  }
+}
+
 void Emulator::emulate() {
   for (;;) {
     if (m_should_pause) {
       m_should_pause = false;
       break;
     }
-    uint8_t opcode = m_processor->fetch_instruction();
-    HuC6280::InstructionHandler<uint8_t> handler =
-        HuC6280::INSTRUCTION_TABLE<uint8_t>[opcode];
-    m_disassembler->disassemble(opcode);
-    uint8_t cycles = handler(m_processor, opcode);
-    m_mapping_controller->step(cycles);
-    m_processor->check_interrupts();
+    step();
+  }
+}
+
+void Emulator::emulate_cycles(uint64_t cycles) {
+  uint64_t target = m_executed_cycles + cycles;
+  while (m_executed_cycles < target) {
+    if (m_should_pause) {
+      m_should_pause = false;
+      break;
+    }
+    step();
+  }
+}
+
+void Emulator::emulate_instructions(uint64_t instructions) {
+  uint64_t target = m_executed_instructions + instructions;
+  while (m_executed_instructions < target) {
+    if (m_should_pause) {
+      m_should_pause = false;
+      break;
+    }
+    step();
+  }
+}
+
+void Emulator::emulate_frames(uint64_t frames) {
+  uint64_t target = m_frame + frames;
+  while (m_frame < target) {
+    if (m_should_pause) {
+      m_should_pause = false;
+      break;
+    }
+    step();
   }
 }
 
@@ -68,7 +269,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     disassembler_logger->set_pattern("%v");
   }
-  spdlog::register_logger(disassembler_logger);
+  REGISTER_LOGGER(disassembler_logger);
 
   auto interrupt_controller_logger = std::make_shared<spdlog::logger>(
       Interrupt::LOGGER_NAME,
@@ -78,7 +279,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     interrupt_controller_logger->set_pattern("%v");
   }
-  spdlog::register_logger(interrupt_controller_logger);
+  REGISTER_LOGGER(interrupt_controller_logger);
 
   auto io_logger = std::make_shared<spdlog::logger>(
       IO::LOGGER_NAME, spdlog::sinks_init_list({console_sink, file_sink}));
@@ -86,7 +287,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     io_logger->set_pattern("%v");
   }
-  spdlog::register_logger(io_logger);
+  REGISTER_LOGGER(io_logger);
 
   auto mapping_controller_logger = std::make_shared<spdlog::logger>(
       Mapping::LOGGER_NAME, spdlog::sinks_init_list({console_sink, file_sink}));
@@ -95,7 +296,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     mapping_controller_logger->set_pattern("%v");
   }
-  spdlog::register_logger(mapping_controller_logger);
+  REGISTER_LOGGER(mapping_controller_logger);
 
   auto processor_logger = std::make_shared<spdlog::logger>(
       LOGGER_NAME, spdlog::sinks_init_list({console_sink, file_sink}));
@@ -104,7 +305,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     processor_logger->set_pattern("%v");
   }
-  spdlog::register_logger(processor_logger);
+  REGISTER_LOGGER(processor_logger);
 
   auto programmable_sound_generator_logger = std::make_shared<spdlog::logger>(
       ProgrammableSoundGenerator::LOGGER_NAME,
@@ -114,7 +315,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     programmable_sound_generator_logger->set_pattern("%v");
   }
-  spdlog::register_logger(programmable_sound_generator_logger);
+  REGISTER_LOGGER(programmable_sound_generator_logger);
 
   auto timer_logger = std::make_shared<spdlog::logger>(
       Timer::LOGGER_NAME, spdlog::sinks_init_list({console_sink, file_sink}));
@@ -122,7 +323,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     timer_logger->set_pattern("%v");
   }
-  spdlog::register_logger(timer_logger);
+  REGISTER_LOGGER(timer_logger);
 
   auto video_color_encoder_logger = std::make_shared<spdlog::logger>(
       HuC6260::LOGGER_NAME, spdlog::sinks_init_list({console_sink, file_sink}));
@@ -131,7 +332,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     video_color_encoder_logger->set_pattern("%v");
   }
-  spdlog::register_logger(video_color_encoder_logger);
+  REGISTER_LOGGER(video_color_encoder_logger);
 
   auto video_display_controller_logger = std::make_shared<spdlog::logger>(
       HuC6270::LOGGER_NAME, spdlog::sinks_init_list({console_sink, file_sink}));
@@ -140,7 +341,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     video_display_controller_logger->set_pattern("%v");
   }
-  spdlog::register_logger(video_display_controller_logger);
+  REGISTER_LOGGER(video_display_controller_logger);
 
   auto block_transfer_instruction_logger = std::make_shared<spdlog::logger>(
       HuC6280::BLOCK_TRANSFER_LOGGER_NAME,
@@ -150,7 +351,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     block_transfer_instruction_logger->set_pattern("%v");
   }
-  spdlog::register_logger(block_transfer_instruction_logger);
+  REGISTER_LOGGER(block_transfer_instruction_logger);
 
   auto stack_logger = std::make_shared<spdlog::logger>(
       HuC6280::STACK_LOGGER_NAME,
@@ -159,7 +360,7 @@ void Emulator::register_loggers(
   if (!log_formatter_config.enabled) {
     stack_logger->set_pattern("%v");
   }
-  spdlog::register_logger(stack_logger);
+  REGISTER_LOGGER(stack_logger);
 }
 
 void Emulator::initialize(const std::filesystem::path &rom,
@@ -169,11 +370,176 @@ void Emulator::initialize(const std::filesystem::path &rom,
   m_processor->initialize(rom);
 }
 
+void Emulator::initialize(const std::vector<uint8_t> &rom,
+                          const LogLevelConfig &log_level_config,
+                          const LogFormatterConfig &log_formatter_config) {
+  Emulator::register_loggers(log_level_config, log_formatter_config);
+  m_processor->initialize(rom);
+}
+
 void Emulator::set_vsync_callback(
     const std::function<void(std::unique_ptr<RendererInfo> &)>
         &vsync_callback) {
-  m_video_display_controller->set_vsync_callback(
-      [=] { vsync_callback(this->m_renderer_info); });
+  m_vsync_callback = vsync_callback;
+}
+
+void Emulator::set_audio_sample_rate(unsigned int sample_rate) {
+  m_programmable_sound_generator_controller->set_sample_rate(sample_rate);
+}
+
+void Emulator::set_audio_callback(
+    const std::function<void(const std::vector<float> &)> &audio_callback) {
+  m_programmable_sound_generator_controller->set_audio_callback(
+      audio_callback);
+}
+
+void Emulator::set_int16_audio_callback(
+    const std::function<void(const std::vector<int16_t> &)>
+        &int16_audio_callback) {
+  m_programmable_sound_generator_controller->set_int16_audio_callback(
+      int16_audio_callback);
+}
+
+void Emulator::attach_audio_ring_buffer(
+    const std::shared_ptr<AudioRingBuffer> &audio_ring_buffer) {
+  m_programmable_sound_generator_controller->attach_audio_ring_buffer(
+      audio_ring_buffer);
+}
+
+void Emulator::set_audio_rate_adjustment(double ratio) {
+  m_programmable_sound_generator_controller->set_rate_adjustment(ratio);
 }
 
 void Emulator::set_should_pause() { m_should_pause = true; }
+
+void Emulator::set_joypad_buttons(uint8_t buttons) {
+  m_joypad_buttons.store(buttons, std::memory_order_relaxed);
+}
+
+void Emulator::attach_input_movie(
+    const std::shared_ptr<InputMovie> &input_movie, InputMovieMode mode) {
+  m_input_movie = input_movie;
+  m_input_movie_mode = mode;
+}
+
+void Emulator::attach_frame_sink(const std::shared_ptr<FrameSink> &frame_sink) {
+  m_video_display_controller->attach_frame_sink(frame_sink);
+}
+
+void Emulator::attach_pc_sampler(const std::shared_ptr<PCSampler> &pc_sampler) {
+  m_pc_sampler = pc_sampler;
+}
+
+auto Emulator::get_pc_sampler_report(size_t count) -> std::string {
+  if (!m_pc_sampler) {
+    return "";
+  }
+  uint64_t samples = m_pc_sampler->get_samples();
+  std::string report =
+      fmt::format("{} samples, {} dropped\n", samples,
+                  m_pc_sampler->get_dropped());
+  report += fmt::format("{:<10} {:<7} {:>10} {:>7}  {}\n", "physical",
+                        "logical", "samples", "%", "instruction");
+  for (const auto &entry : m_pc_sampler->get_top(count)) {
+    report += fmt::format(
+        "{:02X}:{:04X}    {:04X}    {:>10} {:>6.2f}%  {}\n",
+        entry.physical_address >> 13, entry.physical_address & 0x1FFF,
+        entry.logical_address, entry.count,
+        static_cast<double>(entry.count) / static_cast<double>(samples) * 100.0,
+        m_disassembler->disassemble_at(entry.physical_address,
+                                       entry.logical_address));
+  }
+  return report;
+}
+
+void Emulator::attach_call_profiler(
+    const std::shared_ptr<CallProfiler> &call_profiler) {
+  m_call_profiler = call_profiler;
+}
+
+void Emulator::attach_trace_buffer(
+    const std::shared_ptr<TraceBuffer> &trace_buffer) {
+  m_trace_buffer = trace_buffer;
+}
+
+auto Emulator::disassemble(const TraceRecord &record,
+                           const TraceRecord *extension) -> std::string {
+  return m_disassembler->disassemble_record(record, extension);
+}
+
+auto Emulator::disassemble_next_instruction() -> std::string {
+  return m_disassembler->disassemble_at(
+      get_physical_program_counter(),
+      m_processor->get_registers().program_counter.value);
+}
+
+auto Emulator::get_state_digest() const -> StateDigest {
+  const HuC6280::Registers &registers = m_processor->get_registers();
+  const auto &ram = m_mapping_controller->get_ram();
+  const auto &vram = m_video_display_controller->get_vram();
+  std::array<uint16_t, COLOR_TABLE_RAM_NUMBER_OF_COLORS> color_table = {};
+  m_video_color_encoder_controller->copy_color_table(color_table);
+  return {.instructions = m_executed_instructions,
+          .cycles = m_executed_cycles,
+          .program_counter = registers.program_counter.value,
+          .accumulator = registers.accumulator,
+          .x = registers.x,
+          .y = registers.y,
+          .stack_pointer = registers.stack_pointer,
+          .status = registers.status.value,
+          .ram_hash = Common::Hash::xxh64(ram.data(), ram.size()),
+          .vram_hash = Common::Hash::xxh64(vram.data(),
+                                           vram.size() * sizeof(uint16_t)),
+          .color_table_hash = Common::Hash::xxh64(
+              color_table.data(), color_table.size() * sizeof(uint16_t))};
+}
+
+auto Emulator::get_renderer_info() -> std::unique_ptr<RendererInfo> & {
+  return m_renderer_info;
+}
+
+auto Emulator::get_opcode_profiler() -> std::unique_ptr<OpcodeProfiler> & {
+  return m_opcode_profiler;
+}
+
+void Emulator::save_state(std::vector<uint8_t> &state) const {
+  StateWriter writer(state);
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_executed_instructions);
+  writer.write(m_executed_cycles);
+  writer.write(m_frame);
+  writer.end_section();
+  m_processor->save_state(writer);
+  m_mapping_controller->save_state(writer);
+  m_interrupt_controller->save_state(writer);
+  m_video_color_encoder_controller->save_state(writer);
+  m_video_display_controller->save_state(writer);
+  m_programmable_sound_generator_controller->save_state(writer);
+}
+
+auto Emulator::load_state(const std::vector<uint8_t> &state) -> bool {
+  // A snapshot with a missing or short section is only found out about after
+  // the sections before it are loaded, so it goes through scratch controllers
+  // first and the emulator is only touched once the whole of it has loaded
+  if (!m_state_scratch) {
+    m_state_scratch = std::make_unique<Machine>();
+  }
+  uint64_t executed_instructions = 0;
+  uint64_t executed_cycles = 0;
+  uint64_t frame = 0;
+  if (!LOAD_STATE_SECTIONS(
+          state, executed_instructions, executed_cycles, frame,
+          *m_state_scratch->processor, *m_state_scratch->mapping_controller,
+          *m_state_scratch->interrupt_controller,
+          *m_state_scratch->video_color_encoder_controller,
+          *m_state_scratch->video_display_controller,
+          *m_state_scratch->programmable_sound_generator_controller)) {
+    return false;
+  }
+  return LOAD_STATE_SECTIONS(state, m_executed_instructions, m_executed_cycles,
+                             m_frame, *m_processor, *m_mapping_controller,
+                             *m_interrupt_controller,
+                             *m_video_color_encoder_controller,
+                             *m_video_display_controller,
+                             *m_programmable_sound_generator_controller);
+}
@@ -0,0 +1,127 @@
+#include "sakura/FramePacer.hpp"
+#include "sakura/AudioRingBuffer.hpp"
+#include <algorithm>
+#include <thread>
+
+using namespace Sakura;
+using namespace std::chrono_literals;
+
+const std::chrono::nanoseconds G_MIN_SPIN_WINDOW = 50us;
+const std::chrono::nanoseconds G_MAX_SPIN_WINDOW = 2ms;
+const std::chrono::nanoseconds G_INITIAL_SPIN_WINDOW = 1ms;
+const std::chrono::nanoseconds G_AUDIO_POLL_INTERVAL = 500us;
+// A stalled audio device must not stall emulation
+const unsigned int G_MAX_AUDIO_WAIT_FRAMES = 2;
+
+FramePacer::FramePacer(double frame_rate)
+    : m_mode(FramePacingMode::Clock),
+      m_frame_period(std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(1.0 / frame_rate))),
+      m_audio_target_fill_level(), m_started(),
+      m_spin_window(G_INITIAL_SPIN_WINDOW), m_frames(), m_total_interval(),
+      m_total_jitter(), m_max_jitter(), m_total_waited(), m_late_frames() {}
+
+void FramePacer::set_audio_ring_buffer(
+    const std::shared_ptr<AudioRingBuffer> &audio_ring_buffer,
+    size_t target_fill_level) {
+  m_mode = FramePacingMode::Audio;
+  m_audio_ring_buffer = audio_ring_buffer;
+  m_audio_target_fill_level = target_fill_level;
+}
+
+void FramePacer::sleep_until(Clock::time_point deadline) {
+  for (;;) {
+    Clock::time_point now = Clock::now();
+    if (now >= deadline) {
+      return;
+    }
+    Clock::duration remaining = deadline - now;
+    if (remaining <= m_spin_window) {
+      std::this_thread::yield();
+      continue;
+    }
+    Clock::duration target = remaining - m_spin_window;
+    std::this_thread::sleep_for(target);
+    Clock::duration overshoot = (Clock::now() - now) - target;
+    // Keep the spin window around twice the usual wake up delay
+    m_spin_window = std::clamp<Clock::duration>(
+        (m_spin_window * 7 + overshoot * 2) / 8, G_MIN_SPIN_WINDOW,
+        G_MAX_SPIN_WINDOW);
+  }
+}
+
+void FramePacer::wait_for_audio() {
+  Clock::time_point give_up =
+      Clock::now() + m_frame_period * G_MAX_AUDIO_WAIT_FRAMES;
+  while (m_audio_ring_buffer->get_fill_level() > m_audio_target_fill_level) {
+    if (Clock::now() >= give_up) {
+      return;
+    }
+    std::this_thread::sleep_for(G_AUDIO_POLL_INTERVAL);
+  }
+}
+
+void FramePacer::wait() {
+  Clock::time_point start = Clock::now();
+  if (m_mode == FramePacingMode::Audio) {
+    wait_for_audio();
+  } else {
+    if (!m_started) {
+      m_deadline = start + m_frame_period;
+    }
+    // When emulation falls behind the debt is dropped instead of running
+    // frames back to back to catch up
+    if (start > m_deadline + m_frame_period) {
+      m_deadline = start;
+    }
+    sleep_until(m_deadline);
+    m_deadline += m_frame_period;
+  }
+  Clock::time_point now = Clock::now();
+  record(now, now - start);
+}
+
+void FramePacer::record(Clock::time_point now, Clock::duration waited) {
+  if (!m_started) {
+    m_started = true;
+    m_last_frame = now;
+    return;
+  }
+  Clock::duration interval = now - m_last_frame;
+  Clock::duration jitter = interval > m_frame_period
+                               ? interval - m_frame_period
+                               : m_frame_period - interval;
+  m_last_frame = now;
+  m_frames++;
+  m_total_interval += interval;
+  m_total_jitter += jitter;
+  m_max_jitter = std::max(m_max_jitter, jitter);
+  m_total_waited += waited;
+  if (interval * 2 > m_frame_period * 3) {
+    m_late_frames++;
+  }
+}
+
+auto FramePacer::get_statistics() const -> FramePacerStatistics {
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  if (m_frames == 0) {
+    return {};
+  }
+  double frames = static_cast<double>(m_frames);
+  double total_interval = Milliseconds(m_total_interval).count();
+  return {.frames = m_frames,
+          .average_interval_ms = total_interval / frames,
+          .average_jitter_ms = Milliseconds(m_total_jitter).count() / frames,
+          .max_jitter_ms = Milliseconds(m_max_jitter).count(),
+          .late_frames = m_late_frames,
+          .idle_ratio = Milliseconds(m_total_waited).count() / total_interval};
+}
+
+void FramePacer::reset_statistics() {
+  m_frames = 0;
+  m_total_interval = {};
+  m_total_jitter = {};
+  m_max_jitter = {};
+  m_total_waited = {};
+  m_late_frames = 0;
+}
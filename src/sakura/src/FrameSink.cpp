@@ -0,0 +1,13 @@
+#include "sakura/FrameSink.hpp"
+
+using namespace Sakura;
+
+void Frame::get_rgb_data(
+    std::array<float, FRAME_BUFFER_DATA_LENGTH> &data) const {
+  for (unsigned int i = 0; i < width * height; i++) {
+    uint16_t entry = color_table[dots[i]];
+    data[i * 3] = ((entry >> 3) & 0b111) / 7.0F;
+    data[i * 3 + 1] = ((entry >> 6) & 0b111) / 7.0F;
+    data[i * 3 + 2] = (entry & 0b111) / 7.0F;
+  }
+}
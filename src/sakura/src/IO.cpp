@@ -1,10 +1,34 @@
 #include "IO.hpp"
+#include "State.hpp"
 
 using namespace Sakura::HuC6280::IO;
 
-auto Controller::load() const -> uint8_t { return m_port.value; }
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("IO  ");
 
-void Controller::store(uint8_t value) {
-  (void)value;
-  (void)m_port;
+Controller::Controller() : m_joypad_buttons() {}
+
+auto Controller::load() const -> uint8_t {
+  Port port = m_port;
+  uint8_t buttons =
+      m_output.sel ? m_joypad_buttons >> 4 : m_joypad_buttons & 0xF;
+  uint8_t data = m_output.clr ? 0 : ~buttons & 0xF;
+  port.value = (port.value & 0xF0) | data;
+  return port.value;
+}
+
+void Controller::store(uint8_t value) { m_output.value = value; }
+
+void Controller::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_port);
+  writer.write(m_output);
+  writer.write(m_joypad_buttons);
+  writer.end_section();
+}
+
+void Controller::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_port);
+  reader.read(m_output);
+  reader.read(m_joypad_buttons);
 }
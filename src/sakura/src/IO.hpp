@@ -4,6 +4,11 @@
 #include <cstdint>
 #include <string>
 
+namespace Sakura {
+class StateReader;
+class StateWriter;
+} // namespace Sakura
+
 namespace Sakura::HuC6280::IO {
 
 static const std::string LOGGER_NAME = "----i/o----";
@@ -24,16 +29,38 @@ union Port {
   Port() : value(0xBF) {} // TODO: Remove hardcoded value
 };
 
+union Output {
+  struct {
+    uint8_t sel : 1;
+    uint8_t clr : 1;
+    uint8_t unused : 6;
+  };
+  uint8_t value;
+
+  Output() : value() {}
+};
+
+/*
+The joypad is read through a multiplexer: SEL picks the directions (high) or
+the buttons (low), CLR high forces every data line low. Data lines are
+active low.
+*/
 class Controller {
 private:
   Port m_port;
+  Output m_output;
+  uint8_t m_joypad_buttons;
 
 public:
-  Controller() = default;
+  Controller();
   ~Controller() = default;
 
   [[nodiscard]] auto load() const -> uint8_t;
   void store(uint8_t value);
+  // Bitmask of Sakura::JoypadButton
+  void set_joypad_buttons(uint8_t buttons) { m_joypad_buttons = buttons; }
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 };
 }; // namespace Sakura::HuC6280::IO
 
@@ -0,0 +1,77 @@
+#include "sakura/InputMovie.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+using namespace Sakura;
+
+const std::array<char, 4> G_MAGIC = {'S', 'K', 'M', 'V'};
+const uint32_t G_VERSION = 1;
+
+template <typename T> void WRITE(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> auto READ(std::ifstream &file, T &value) -> bool {
+  file.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return static_cast<bool>(file);
+}
+
+void InputMovie::record(uint64_t frame, uint8_t buttons) {
+  while (!m_events.empty() && m_events.back().frame >= frame) {
+    m_events.pop_back();
+  }
+  if (m_events.empty() ? buttons != 0 : m_events.back().buttons != buttons) {
+    m_events.push_back({static_cast<uint32_t>(frame), buttons});
+  }
+}
+
+auto InputMovie::get_buttons(uint64_t frame) const -> uint8_t {
+  auto next = std::upper_bound(
+      m_events.begin(), m_events.end(), frame,
+      [](uint64_t frame, const InputEvent &event) {
+        return frame < event.frame;
+      });
+  return next == m_events.begin() ? 0 : std::prev(next)->buttons;
+}
+
+auto InputMovie::get_length() const -> uint64_t {
+  return m_events.empty() ? 0 : m_events.back().frame;
+}
+
+auto InputMovie::save(const std::filesystem::path &path) const -> bool {
+  std::ofstream file = std::ofstream(path, std::ios::out | std::ios::binary);
+  file.write(G_MAGIC.data(), G_MAGIC.size());
+  WRITE(file, G_VERSION);
+  WRITE(file, static_cast<uint32_t>(m_events.size()));
+  for (const auto &event : m_events) {
+    WRITE(file, event.frame);
+    WRITE(file, event.buttons);
+  }
+  return static_cast<bool>(file);
+}
+
+auto InputMovie::load(const std::filesystem::path &path) -> bool {
+  std::ifstream file = std::ifstream(path, std::ios::in | std::ios::binary);
+  std::array<char, 4> magic = {};
+  uint32_t version = 0;
+  uint32_t count = 0;
+  file.read(magic.data(), magic.size());
+  if (!file || magic != G_MAGIC || !READ(file, version) ||
+      version != G_VERSION || !READ(file, count)) {
+    return false;
+  }
+  std::vector<InputEvent> events;
+  for (uint32_t i = 0; i < count; i++) {
+    InputEvent event = {};
+    if (!READ(file, event.frame) || !READ(file, event.buttons) ||
+        (!events.empty() && event.frame <= events.back().frame)) {
+      return false;
+    }
+    events.push_back(event);
+  }
+  m_events = std::move(events);
+  return true;
+}
@@ -4,6 +4,7 @@
 #include <array>
 #include <cstdint>
 #include <memory>
+#include <string>
 
 namespace Sakura::HuC6280 {
 class Processor;
@@ -229,6 +230,12 @@ const std::array<InstructionHandler<T>, 0x100> INSTRUCTION_TABLE = {
 };
 // clang-format on
 
+// The interpreter handlers are only compiled into the emulator, code outside
+// the library runs instructions through this table instead of including
+// Instructions_Impl.hpp
+extern const std::array<InstructionHandler<uint8_t>, 0x100>
+    &INTERPRETER_TABLE;
+
 }; // namespace Sakura::HuC6280
 
 #endif
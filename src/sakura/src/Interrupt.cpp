@@ -1,9 +1,12 @@
 #include "Interrupt.hpp"
+#include "State.hpp"
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
 
 using namespace Sakura::HuC6280::Interrupt;
 
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("IRQ ");
+
 auto Controller::load(uint16_t offset) const -> uint8_t {
   switch (offset & 0b11) {
   case 0b10:
@@ -55,3 +58,17 @@ auto Controller::priority_request() const -> RequestField {
   }
   return RequestField::None;
 }
+
+void Controller::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  // Request is two bytes wide and only value is ever set
+  writer.write(m_request.value);
+  writer.write(m_disable.value);
+  writer.end_section();
+}
+
+void Controller::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_request.value);
+  reader.read(m_disable.value);
+}
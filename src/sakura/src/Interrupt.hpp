@@ -4,6 +4,11 @@
 #include <cstdint>
 #include <string>
 
+namespace Sakura {
+class StateReader;
+class StateWriter;
+} // namespace Sakura
+
 namespace Sakura::HuC6280::Interrupt {
 
 static const std::string LOGGER_NAME = "-interrupt-";
@@ -54,6 +59,8 @@ public:
   void request_interrupt(RequestField field);
   void acknowledge_interrupt(RequestField field);
   [[nodiscard]] auto priority_request() const -> RequestField;
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 };
 }; // namespace Sakura::HuC6280::Interrupt
 
@@ -0,0 +1,152 @@
+#include "LineRenderer.hpp"
+#include <algorithm>
+
+using namespace Sakura::HuC6270;
+
+const uint16_t G_CONTROL_SPRITE_BLANKING = 1 << 6;
+const uint16_t G_CONTROL_BACKGROUND_BLANKING = 1 << 7;
+const uint16_t G_SPRITE_COLOR_SECTION = 0x100;
+// Marks sprite dots that are drawn in front of the background
+const uint16_t G_SPRITE_PRIORITY = 0x8000;
+const uint16_t G_COLOR_TABLE_ADDRESS_MASK = 0x1FF;
+const uint16_t G_BACKGROUND_Y_MASK = 0x1FF;
+const uint16_t G_VRAM_MASK = 0x7FFF;
+
+LineRenderer::LineRenderer()
+    : m_frame_buffer(), m_width(), m_height(), m_characters(),
+      m_sprite_line() {}
+
+void LineRenderer::configure(unsigned int width, unsigned int height) {
+  width = std::min(width, FRAME_BUFFER_MAX_WIDTH);
+  height = std::min(height, FRAME_BUFFER_MAX_HEIGHT);
+  if (width != m_width || height != m_height) {
+    m_width = width;
+    m_height = height;
+    m_frame_buffer.fill(0);
+  }
+}
+
+void LineRenderer::render(const std::array<uint16_t, 0x8000> &vram,
+                          const BackgroundAttributeTableFetcher &fetcher,
+                          const SpriteAttributeTable &sprite_attribute_table,
+                          const ScanlineRegisters &registers,
+                          unsigned int first_line, unsigned int count) {
+  bool background = (registers.control & G_CONTROL_BACKGROUND_BLANKING) != 0;
+  bool sprites = (registers.control & G_CONTROL_SPRITE_BLANKING) != 0;
+  unsigned int characters = (m_width / CHARACTER_DOTS_WIDTH) + 1;
+  unsigned int fine_x = registers.x_scroll % CHARACTER_DOTS_WIDTH;
+  // Every line in the run shares the horizontal scroll, so the characters
+  // only have to be fetched again when the run crosses a character row
+  unsigned int fetched_row = ~0U;
+  for (unsigned int i = 0; i < count; i++) {
+    unsigned int line = first_line + i;
+    if (line >= m_height) {
+      break;
+    }
+    uint16_t *dots = &m_frame_buffer[line * m_width];
+    if (background) {
+      unsigned int y = (registers.y_scroll + i) & G_BACKGROUND_Y_MASK;
+      unsigned int row = y / CHARACTER_DOTS_HEIGHT;
+      if (row != fetched_row) {
+        fetcher.fetch_line(vram, registers.x_scroll, y, m_characters.data(),
+                           characters);
+        fetched_row = row;
+      }
+      render_background_line(vram, fine_x, y % CHARACTER_DOTS_HEIGHT, dots);
+    } else {
+      std::fill(dots, dots + m_width, 0);
+    }
+    if (sprites) {
+      render_sprite_line(vram, sprite_attribute_table, line, dots);
+    }
+  }
+}
+
+void LineRenderer::render_background_line(
+    const std::array<uint16_t, 0x8000> &vram, unsigned int fine_x,
+    unsigned int fine_y, uint16_t *dots) const {
+  unsigned int characters = (m_width / CHARACTER_DOTS_WIDTH) + 1;
+  for (unsigned int c = 0; c < characters; c++) {
+    const Character &character = m_characters[c];
+    uint16_t address = (character.code << 4) + fine_y;
+    uint16_t ch1_ch0 = vram[address & G_VRAM_MASK];
+    uint16_t ch3_ch2 = vram[(address + 8) & G_VRAM_MASK];
+    uint16_t color_area = character.cg_color << 4;
+    for (unsigned int bit = 0; bit < CHARACTER_DOTS_WIDTH; bit++) {
+      unsigned int x = c * CHARACTER_DOTS_WIDTH + bit;
+      if (x < fine_x || x - fine_x >= m_width) {
+        continue;
+      }
+      unsigned int shift = CHARACTER_DOTS_WIDTH - 1 - bit;
+      uint16_t pattern_color = ((ch1_ch0 >> shift) & 0b1) |
+                               (((ch1_ch0 >> (shift + 8)) & 0b1) << 1) |
+                               (((ch3_ch2 >> shift) & 0b1) << 2) |
+                               (((ch3_ch2 >> (shift + 8)) & 0b1) << 3);
+      dots[x - fine_x] = pattern_color == 0 ? 0 : color_area | pattern_color;
+    }
+  }
+}
+
+void LineRenderer::render_sprite_line(
+    const std::array<uint16_t, 0x8000> &vram,
+    const SpriteAttributeTable &sprite_attribute_table, unsigned int line,
+    uint16_t *dots) {
+  const ScanlineSprites &scanline =
+      sprite_attribute_table.get_scanline_sprites(line);
+  if (scanline.count == 0) {
+    return;
+  }
+  std::fill(m_sprite_line.begin(), m_sprite_line.begin() + m_width, 0);
+  for (unsigned int i = 0; i < scanline.count; i++) {
+    const Sprite &sprite =
+        sprite_attribute_table.get_sprite(scanline.indexes[i]);
+    unsigned int sprite_line = line - sprite.y;
+    if (sprite.flags.y_invert != 0) {
+      sprite_line = sprite.height - 1 - sprite_line;
+    }
+    unsigned int cell_y = sprite_line / SPRITE_CELL_DOTS_HEIGHT;
+    unsigned int cell_line = sprite_line % SPRITE_CELL_DOTS_HEIGHT;
+    uint16_t color = G_SPRITE_COLOR_SECTION | (sprite.flags.color_area << 4);
+    if (sprite.flags.priority != 0) {
+      color |= G_SPRITE_PRIORITY;
+    }
+    unsigned int cells = sprite.width / SPRITE_CELL_DOTS_WIDTH;
+    for (unsigned int cell_x = 0; cell_x < cells; cell_x++) {
+      // Cells are laid out two per row in the pattern area, each one made of
+      // four planes of sixteen words
+      uint16_t address = sprite.pattern_address +
+                         ((cell_y * 2 + cell_x) << 6) + cell_line;
+      std::array<uint16_t, 4> planes = {
+          vram[address & G_VRAM_MASK], vram[(address + 16) & G_VRAM_MASK],
+          vram[(address + 32) & G_VRAM_MASK],
+          vram[(address + 48) & G_VRAM_MASK]};
+      for (unsigned int bit = 0; bit < SPRITE_CELL_DOTS_WIDTH; bit++) {
+        unsigned int shift = SPRITE_CELL_DOTS_WIDTH - 1 - bit;
+        uint16_t pattern_color = ((planes[0] >> shift) & 0b1) |
+                                 (((planes[1] >> shift) & 0b1) << 1) |
+                                 (((planes[2] >> shift) & 0b1) << 2) |
+                                 (((planes[3] >> shift) & 0b1) << 3);
+        if (pattern_color == 0) {
+          continue;
+        }
+        int sprite_x = static_cast<int>(cell_x * SPRITE_CELL_DOTS_WIDTH + bit);
+        if (sprite.flags.x_invert != 0) {
+          sprite_x = static_cast<int>(sprite.width) - 1 - sprite_x;
+        }
+        int x = sprite.x + sprite_x;
+        // Sprites with lower numbers are displayed in front of the others
+        if (x < 0 || x >= static_cast<int>(m_width) || m_sprite_line[x] != 0) {
+          continue;
+        }
+        m_sprite_line[x] = color | pattern_color;
+      }
+    }
+  }
+  for (unsigned int x = 0; x < m_width; x++) {
+    uint16_t sprite_dot = m_sprite_line[x];
+    if (sprite_dot != 0 &&
+        ((sprite_dot & G_SPRITE_PRIORITY) != 0 || (dots[x] & 0xF) == 0)) {
+      dots[x] = sprite_dot & G_COLOR_TABLE_ADDRESS_MASK;
+    }
+  }
+}
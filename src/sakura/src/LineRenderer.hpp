@@ -0,0 +1,58 @@
+#ifndef SAKURA_LINE_RENDERER_HPP
+#define SAKURA_LINE_RENDERER_HPP
+
+#include "BackgroundAttributeTable.hpp"
+#include "SpriteAttributeTable.hpp"
+#include <array>
+#include <cstdint>
+#include <sakura/Constants.hpp>
+
+namespace Sakura::HuC6270 {
+
+// Raster registers latched at the start of each displayed line, y_scroll is
+// the effective background line rather than the value written to BYR
+struct ScanlineRegisters {
+  uint16_t x_scroll;
+  uint16_t y_scroll;
+  uint16_t control;
+};
+
+class LineRenderer {
+private:
+  // Each dot holds the color table RAM address it resolves to
+  std::array<uint16_t, FRAME_BUFFER_MAX_DOTS> m_frame_buffer;
+  unsigned int m_width;
+  unsigned int m_height;
+
+  std::array<Character, (FRAME_BUFFER_MAX_WIDTH / CHARACTER_DOTS_WIDTH) + 1>
+      m_characters;
+  std::array<uint16_t, FRAME_BUFFER_MAX_WIDTH> m_sprite_line;
+
+  void render_background_line(const std::array<uint16_t, 0x8000> &vram,
+                              unsigned int fine_x, unsigned int fine_y,
+                              uint16_t *dots) const;
+  void render_sprite_line(const std::array<uint16_t, 0x8000> &vram,
+                          const SpriteAttributeTable &sprite_attribute_table,
+                          unsigned int line, uint16_t *dots);
+
+public:
+  LineRenderer();
+  ~LineRenderer() = default;
+
+  void configure(unsigned int width, unsigned int height);
+  void render(const std::array<uint16_t, 0x8000> &vram,
+              const BackgroundAttributeTableFetcher &fetcher,
+              const SpriteAttributeTable &sprite_attribute_table,
+              const ScanlineRegisters &registers, unsigned int first_line,
+              unsigned int count);
+
+  [[nodiscard]] auto get_frame_buffer() const
+      -> const std::array<uint16_t, FRAME_BUFFER_MAX_DOTS> & {
+    return m_frame_buffer;
+  }
+  [[nodiscard]] auto get_width() const -> unsigned int { return m_width; }
+  [[nodiscard]] auto get_height() const -> unsigned int { return m_height; }
+};
+}; // namespace Sakura::HuC6270
+
+#endif
@@ -0,0 +1,87 @@
+#include "sakura/Lockstep.hpp"
+#include "sakura/Emulator.hpp"
+#include <algorithm>
+#include <fmt/core.h>
+#include <utility>
+#include <vector>
+
+using namespace Sakura;
+
+auto IS_SAME_STATE(const StateDigest &a, const StateDigest &b) -> bool {
+  return a.instructions == b.instructions && a.cycles == b.cycles &&
+         a.program_counter == b.program_counter &&
+         a.accumulator == b.accumulator && a.x == b.x && a.y == b.y &&
+         a.stack_pointer == b.stack_pointer && a.status == b.status &&
+         a.ram_hash == b.ram_hash && a.vram_hash == b.vram_hash &&
+         a.color_table_hash == b.color_table_hash;
+}
+
+Lockstep::Lockstep(Emulator &reference, Emulator &candidate,
+                   LockstepGranularity granularity, uint64_t block_cycles)
+    : m_reference(reference), m_candidate(candidate),
+      m_granularity(granularity), m_block_cycles(std::max<uint64_t>(
+                                      block_cycles, 1)),
+      m_steps(), m_last_digest(reference.get_state_digest()) {}
+
+void Lockstep::advance(Emulator &emulator) const {
+  switch (m_granularity) {
+  case LockstepGranularity::Instruction:
+    emulator.emulate_instructions(1);
+    break;
+  case LockstepGranularity::Block:
+    emulator.emulate_cycles(m_block_cycles);
+    break;
+  case LockstepGranularity::Frame:
+    emulator.emulate_frames(1);
+    break;
+  }
+}
+
+auto Lockstep::step() -> bool {
+  if (!m_report.empty()) {
+    return false;
+  }
+  advance(m_reference);
+  advance(m_candidate);
+  m_steps++;
+  StateDigest reference = m_reference.get_state_digest();
+  StateDigest candidate = m_candidate.get_state_digest();
+  if (IS_SAME_STATE(reference, candidate)) {
+    m_last_digest = reference;
+    return true;
+  }
+  m_report = get_context(reference, candidate);
+  return false;
+}
+
+auto Lockstep::get_context(const StateDigest &reference,
+                           const StateDigest &candidate) -> std::string {
+  std::vector<std::pair<std::string, std::pair<uint64_t, uint64_t>>> fields =
+      {{"instructions", {reference.instructions, candidate.instructions}},
+       {"cycles", {reference.cycles, candidate.cycles}},
+       {"pc", {reference.program_counter, candidate.program_counter}},
+       {"a", {reference.accumulator, candidate.accumulator}},
+       {"x", {reference.x, candidate.x}},
+       {"y", {reference.y, candidate.y}},
+       {"s", {reference.stack_pointer, candidate.stack_pointer}},
+       {"p", {reference.status, candidate.status}},
+       {"ram", {reference.ram_hash, candidate.ram_hash}},
+       {"vram", {reference.vram_hash, candidate.vram_hash}},
+       {"ctram", {reference.color_table_hash, candidate.color_table_hash}}};
+  std::string context =
+      fmt::format("Diverged at step {}, both agreed at instruction {}, "
+                  "cycle {}, pc {:#06x}\n",
+                  m_steps, m_last_digest.instructions, m_last_digest.cycles,
+                  m_last_digest.program_counter);
+  context += fmt::format("  {:<12} {:>18} {:>18}\n", "", "reference",
+                         "candidate");
+  for (const auto &[name, values] : fields) {
+    context += fmt::format("{} {:<12} {:>#18x} {:>#18x}\n",
+                           values.first == values.second ? ' ' : '*', name,
+                           values.first, values.second);
+  }
+  context += fmt::format("  next         {}\n  {:<12} {}\n",
+                         m_reference.disassemble_next_instruction(), "",
+                         m_candidate.disassemble_next_instruction());
+  return context;
+}
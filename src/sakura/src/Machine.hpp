@@ -0,0 +1,83 @@
+#ifndef SAKURA_MACHINE_HPP
+#define SAKURA_MACHINE_HPP
+
+#include "Disassembler.hpp"
+#include "IO.hpp"
+#include "Interrupt.hpp"
+#include "Memory.hpp"
+#include "Processor.hpp"
+#include "ProgrammableSoundGenerator.hpp"
+#include "Timer.hpp"
+#include "VideoColorEncoder.hpp"
+#include "VideoDisplayController.hpp"
+#include <memory>
+#include <sakura/Emulator.hpp>
+#include <sakura/RendererInfo.hpp>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+
+namespace Sakura {
+
+/*
+Same wiring as the emulator, with every controller reachable. Used by the
+tests and benchmarks that drive the controllers directly instead of running
+a ROM, and by the emulator to check a snapshot loads before loading it.
+Nothing is reset, stack operations need the stack pointer to have been set
+once.
+*/
+struct Machine {
+  std::unique_ptr<HuC6280::Interrupt::Controller> interrupt_controller;
+  std::unique_ptr<HuC6260::Controller> video_color_encoder_controller;
+  std::unique_ptr<HuC6270::Controller> video_display_controller;
+  std::unique_ptr<HuC6280::ProgrammableSoundGenerator::Controller>
+      programmable_sound_generator_controller;
+  std::unique_ptr<HuC6280::Mapping::Controller> mapping_controller;
+  std::unique_ptr<HuC6280::Processor> processor;
+  std::unique_ptr<RendererInfo> renderer_info;
+
+  Machine()
+      : interrupt_controller(
+            std::make_unique<HuC6280::Interrupt::Controller>()),
+        video_color_encoder_controller(std::make_unique<HuC6260::Controller>()),
+        video_display_controller(std::make_unique<HuC6270::Controller>(
+            VDCConfig{.deadbeef_vram = false}, interrupt_controller,
+            video_color_encoder_controller)),
+        programmable_sound_generator_controller(
+            std::make_unique<
+                HuC6280::ProgrammableSoundGenerator::Controller>()),
+        mapping_controller(std::make_unique<HuC6280::Mapping::Controller>(
+            MOS6502ModeConfig{.enabled = false}, interrupt_controller,
+            video_color_encoder_controller, video_display_controller,
+            programmable_sound_generator_controller)),
+        processor(std::make_unique<HuC6280::Processor>(
+            MOS6502ModeConfig{.enabled = false}, mapping_controller,
+            interrupt_controller)),
+        renderer_info(std::make_unique<RendererInfo>(
+            video_display_controller, video_color_encoder_controller)) {}
+
+  void map_all(uint8_t bank) {
+    for (uint8_t i = 0; i < 8; i++) {
+      mapping_controller->set_mapping_register(i, bank);
+    }
+  }
+
+  // The controllers log through named loggers that the emulator registers,
+  // loggers that already exist are kept
+  static void register_null_loggers() {
+    for (const auto &name :
+         {HuC6280::LOGGER_NAME, HuC6280::BLOCK_TRANSFER_LOGGER_NAME,
+          HuC6280::STACK_LOGGER_NAME, HuC6280::Mapping::LOGGER_NAME,
+          HuC6280::Interrupt::LOGGER_NAME, HuC6280::IO::LOGGER_NAME,
+          HuC6280::Timer::LOGGER_NAME,
+          HuC6280::ProgrammableSoundGenerator::LOGGER_NAME,
+          HuC6280::DISASSEMBLER_LOGGER_NAME, HuC6260::LOGGER_NAME,
+          HuC6270::LOGGER_NAME}) {
+      if (spdlog::get(name) == nullptr) {
+        spdlog::null_logger_mt(name)->set_level(spdlog::level::off);
+      }
+    }
+  }
+};
+}; // namespace Sakura
+
+#endif
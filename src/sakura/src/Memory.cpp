@@ -2,28 +2,34 @@
 #include "IO.hpp"
 #include "Interrupt.hpp"
 #include "ProgrammableSoundGenerator.hpp"
+#include "State.hpp"
 #include "Timer.hpp"
 #include "VideoColorEncoder.hpp"
 #include "VideoDisplayController.hpp"
 #include "sakura/Emulator.hpp"
+#include <algorithm>
 #include <fmt/core.h>
 #include <fstream>
 #include <spdlog/spdlog.h>
 
 using namespace Sakura::HuC6280::Mapping;
 
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("MMU ");
+
 Controller::Controller(
     const Sakura::MOS6502ModeConfig &mos_6502_mode_config,
     std::unique_ptr<HuC6280::Interrupt::Controller> &interrupt_controller,
     std::unique_ptr<HuC6260::Controller> &video_color_encoder_controller,
-    std::unique_ptr<HuC6270::Controller> &video_display_controller)
+    std::unique_ptr<HuC6270::Controller> &video_display_controller,
+    std::unique_ptr<ProgrammableSoundGenerator::Controller>
+        &programmable_sound_generator_controller)
     : m_RAM(), m_ROM(), m_mos_6502_mode_enabled(mos_6502_mode_config.enabled),
       m_IO_controller(std::make_unique<IO::Controller>()),
-      m_programmable_sound_generator_controller(
-          std::make_unique<ProgrammableSoundGenerator::Controller>()),
       m_interrupt_controller(interrupt_controller),
       m_video_color_encoder_controller(video_color_encoder_controller),
       m_video_display_controller(video_display_controller),
+      m_programmable_sound_generator_controller(
+          programmable_sound_generator_controller),
       m_timer_controller(
           std::make_unique<HuC6280::Timer::Controller>(m_interrupt_controller)){
 
@@ -51,6 +57,46 @@ void Controller::load_rom(const std::filesystem::path &path) {
   rom_file.close();
 }
 
+void Controller::load_rom(const std::vector<uint8_t> &rom) {
+  spdlog::get(LOGGER_NAME)
+      ->debug(fmt::format("Loaded ROM image of size: {:#X}", rom.size()));
+  size_t length = std::min(rom.size(), m_ROM.size());
+  std::copy_n(rom.begin(), length, m_ROM.begin());
+  // Nothing of a previously loaded image is left past the end of this one
+  std::fill(m_ROM.begin() + length, m_ROM.end(), 0);
+}
+
+auto Controller::peek(uint16_t logical_address) -> uint8_t {
+  if (m_mos_6502_mode_enabled) {
+    return m_ROM[logical_address];
+  }
+
+  uint8_t bank = m_registers.values[logical_address >> 13];
+  uint32_t offset = logical_address & 0x1FFF;
+  if (bank <= 0x7F) {
+    return m_ROM[bank << 13 | offset];
+  }
+  if (bank >= 0xF8 && bank <= 0xFB) {
+    return m_RAM[offset];
+  }
+  return 0xFF;
+}
+
+void Controller::poke(uint16_t logical_address, uint8_t value) {
+  if (m_mos_6502_mode_enabled) {
+    m_ROM[logical_address] = value;
+    return;
+  }
+
+  uint8_t bank = m_registers.values[logical_address >> 13];
+  uint32_t offset = logical_address & 0x1FFF;
+  if (bank <= 0x7F) {
+    m_ROM[bank << 13 | offset] = value;
+  } else if (bank >= 0xF8 && bank <= 0xFB) {
+    m_RAM[offset] = value;
+  }
+}
+
 auto Controller::load(uint16_t logical_address) -> uint8_t {
   if (m_mos_6502_mode_enabled) {
     return m_ROM[logical_address];
@@ -201,4 +247,27 @@ auto Controller::mapping_register(uint8_t index) -> uint8_t {
 void Controller::step(uint8_t cycles) {
   m_timer_controller->step(cycles);
   m_video_display_controller->step(cycles);
+  m_programmable_sound_generator_controller->step(cycles);
+}
+
+void Controller::set_joypad_buttons(uint8_t buttons) {
+  m_IO_controller->set_joypad_buttons(buttons);
+}
+
+void Controller::save_state(StateWriter &writer) const {
+  // The ROM is loaded from its file again, only writable memory is saved
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_registers);
+  writer.write(m_RAM);
+  writer.end_section();
+  m_IO_controller->save_state(writer);
+  m_timer_controller->save_state(writer);
+}
+
+void Controller::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_registers);
+  reader.read(m_RAM);
+  m_IO_controller->load_state(reader);
+  m_timer_controller->load_state(reader);
 }
@@ -6,9 +6,12 @@
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <vector>
 
 namespace Sakura {
 struct MOS6502ModeConfig;
+class StateReader;
+class StateWriter;
 namespace HuC6260 {
 class Controller;
 } // namespace HuC6260
@@ -79,11 +82,11 @@ private:
   const bool m_mos_6502_mode_enabled;
 
   std::unique_ptr<IO::Controller> m_IO_controller;
-  std::unique_ptr<ProgrammableSoundGenerator::Controller>
-      m_programmable_sound_generator_controller;
   std::unique_ptr<HuC6280::Interrupt::Controller> &m_interrupt_controller;
   std::unique_ptr<HuC6260::Controller> &m_video_color_encoder_controller;
   std::unique_ptr<HuC6270::Controller> &m_video_display_controller;
+  std::unique_ptr<ProgrammableSoundGenerator::Controller>
+      &m_programmable_sound_generator_controller;
   std::unique_ptr<HuC6280::Timer::Controller> m_timer_controller;
 
 public:
@@ -91,13 +94,25 @@ public:
       const Sakura::MOS6502ModeConfig &mos_6502_mode_config,
       std::unique_ptr<HuC6280::Interrupt::Controller> &interrupt_controller,
       std::unique_ptr<HuC6260::Controller> &video_color_encoder_controller,
-      std::unique_ptr<HuC6270::Controller> &video_display_controller);
+      std::unique_ptr<HuC6270::Controller> &video_display_controller,
+      std::unique_ptr<ProgrammableSoundGenerator::Controller>
+          &programmable_sound_generator_controller);
   ~Controller();
 
   void initialize();
   void load_rom(const std::filesystem::path &path);
+  // Images larger than the ROM address space are truncated
+  void load_rom(const std::vector<uint8_t> &rom);
 
   auto load(uint16_t logical_address) -> uint8_t;
+  // ROM and RAM only, hardware registers read as 0xFF so they are not
+  // disturbed
+  auto peek(uint16_t logical_address) -> uint8_t;
+  // ROM and RAM only, ROM included, for tools that set up memory directly
+  void poke(uint16_t logical_address, uint8_t value);
+  [[nodiscard]] auto get_ram() const -> const std::array<uint8_t, 0x2000> & {
+    return m_RAM;
+  }
   void store(uint16_t logical_address, uint8_t value);
   void store_video_display_controller(uint32_t physical_address, uint8_t value);
 
@@ -105,6 +120,9 @@ public:
   auto mapping_register(uint8_t index) -> uint8_t;
 
   void step(uint8_t cycles);
+  void set_joypad_buttons(uint8_t buttons);
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 };
 }; // namespace Mapping
 }; // namespace HuC6280
@@ -0,0 +1,98 @@
+#include "sakura/OpcodeProfiler.hpp"
+#include <algorithm>
+#include <fmt/core.h>
+
+using namespace Sakura;
+
+OpcodeProfiler::OpcodeProfiler()
+    : m_executions(), m_cycles(), m_samples(), m_sampled_ticks(),
+      m_countdown(OPCODE_PROFILER_SAMPLE_INTERVAL),
+      m_start_time(Clock::now()), m_start_ticks(read_ticks()) {}
+
+auto OpcodeProfiler::is_compiled_in() -> bool {
+#if defined(SAKURA_OPCODE_PROFILER)
+  return true;
+#else
+  return false;
+#endif
+}
+
+auto OpcodeProfiler::get_nanoseconds_per_tick() const -> double {
+  std::chrono::duration<double, std::nano> elapsed =
+      Clock::now() - m_start_time;
+  uint64_t ticks = read_ticks() - m_start_ticks;
+  if (ticks == 0) {
+    return 0.0;
+  }
+  return elapsed.count() / static_cast<double>(ticks);
+}
+
+void OpcodeProfiler::reset() {
+  m_executions.fill(0);
+  m_cycles.fill(0);
+  m_samples.fill(0);
+  m_sampled_ticks.fill(0);
+  m_countdown = OPCODE_PROFILER_SAMPLE_INTERVAL;
+  m_start_time = Clock::now();
+  m_start_ticks = read_ticks();
+}
+
+auto OpcodeProfiler::get_profile() const -> std::vector<OpcodeProfile> {
+  double nanoseconds_per_tick = get_nanoseconds_per_tick();
+  std::vector<OpcodeProfile> profile;
+  for (unsigned int opcode = 0; opcode < m_executions.size(); opcode++) {
+    if (m_executions[opcode] == 0) {
+      continue;
+    }
+    double host_nanoseconds = 0.0;
+    if (m_samples[opcode] != 0) {
+      host_nanoseconds = static_cast<double>(m_sampled_ticks[opcode]) /
+                         static_cast<double>(m_samples[opcode]) *
+                         static_cast<double>(m_executions[opcode]) *
+                         nanoseconds_per_tick;
+    }
+    profile.push_back({.opcode = static_cast<uint8_t>(opcode),
+                       .executions = m_executions[opcode],
+                       .cycles = m_cycles[opcode],
+                       .host_nanoseconds = host_nanoseconds});
+  }
+  std::stable_sort(profile.begin(), profile.end(),
+                   [](const OpcodeProfile &a, const OpcodeProfile &b) {
+                     return a.host_nanoseconds > b.host_nanoseconds;
+                   });
+  return profile;
+}
+
+auto OpcodeProfiler::get_report() const -> std::string {
+  std::vector<OpcodeProfile> profile = get_profile();
+  uint64_t total_executions = 0;
+  uint64_t total_cycles = 0;
+  double total_host_nanoseconds = 0.0;
+  for (const auto &entry : profile) {
+    total_executions += entry.executions;
+    total_cycles += entry.cycles;
+    total_host_nanoseconds += entry.host_nanoseconds;
+  }
+  auto share = [](double value, double total) {
+    return total == 0.0 ? 0.0 : value / total * 100.0;
+  };
+
+  std::string report =
+      fmt::format("{:<6} {:>14} {:>7} {:>14} {:>7} {:>12} {:>7} {:>9}\n",
+                  "opcode", "executions", "%", "cycles", "%", "host ms", "%",
+                  "ns/exec");
+  for (const auto &entry : profile) {
+    report += fmt::format(
+        "{:#04x}   {:>14} {:>6.2f}% {:>14} {:>6.2f}% {:>12.3f} {:>6.2f}% "
+        "{:>9.2f}\n",
+        entry.opcode, entry.executions,
+        share(entry.executions, total_executions), entry.cycles,
+        share(entry.cycles, total_cycles), entry.host_nanoseconds / 1e6,
+        share(entry.host_nanoseconds, total_host_nanoseconds),
+        entry.host_nanoseconds / static_cast<double>(entry.executions));
+  }
+  report += fmt::format("{:<6} {:>14} {:>7} {:>14} {:>7} {:>12.3f}\n", "total",
+                        total_executions, "", total_cycles, "",
+                        total_host_nanoseconds / 1e6);
+  return report;
+}
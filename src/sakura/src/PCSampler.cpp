@@ -0,0 +1,61 @@
+#include "sakura/PCSampler.hpp"
+#include <algorithm>
+#include <iterator>
+
+using namespace Sakura;
+
+// Neighbouring addresses land far apart, so loops don't form long probes
+const uint32_t G_HASH_MULTIPLIER = 2654435761U;
+
+auto ROUND_UP_TO_POWER_OF_2(size_t value) -> size_t {
+  size_t power = 1;
+  while (power < value) {
+    power <<= 1;
+  }
+  return power;
+}
+
+PCSampler::PCSampler(unsigned int interval, size_t capacity)
+    : m_slots(ROUND_UP_TO_POWER_OF_2(std::max<size_t>(capacity, 1))),
+      m_interval(std::max(interval, 1U)), m_countdown(m_interval),
+      m_samples(), m_dropped() {}
+
+void PCSampler::sample(uint32_t physical_address, uint16_t logical_address) {
+  m_samples++;
+  size_t mask = m_slots.size() - 1;
+  size_t index = (physical_address * G_HASH_MULTIPLIER) & mask;
+  for (size_t probe = 0; probe < m_slots.size(); probe++) {
+    PCSample &slot = m_slots[(index + probe) & mask];
+    if (slot.count == 0) {
+      slot.physical_address = physical_address;
+    } else if (slot.physical_address != physical_address) {
+      continue;
+    }
+    slot.logical_address = logical_address;
+    slot.count++;
+    return;
+  }
+  m_dropped++;
+}
+
+void PCSampler::clear() {
+  std::fill(m_slots.begin(), m_slots.end(), PCSample());
+  m_countdown = m_interval;
+  m_samples = 0;
+  m_dropped = 0;
+}
+
+auto PCSampler::get_top(size_t count) const -> std::vector<PCSample> {
+  std::vector<PCSample> top;
+  std::copy_if(m_slots.begin(), m_slots.end(), std::back_inserter(top),
+               [](const PCSample &slot) { return slot.count != 0; });
+  count = std::min(count, top.size());
+  std::partial_sort(top.begin(), top.begin() + count, top.end(),
+                    [](const PCSample &a, const PCSample &b) {
+                      return a.count > b.count ||
+                             (a.count == b.count &&
+                              a.physical_address < b.physical_address);
+                    });
+  top.resize(count);
+  return top;
+}
@@ -1,11 +1,15 @@
 #include "Processor.hpp"
 #include "Interrupt.hpp"
 #include "Memory.hpp"
+#include "State.hpp"
 #include "sakura/Emulator.hpp"
 #include <spdlog/spdlog.h>
+#include <vector>
 
 using namespace Sakura::HuC6280;
 
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("CPU ");
+
 Processor::Processor(
     const Sakura::MOS6502ModeConfig &mos_6502_mode_config,
     std::unique_ptr<Mapping::Controller> &mapping_controller,
@@ -18,6 +22,16 @@ Processor::Processor(
       m_stack_pointer_initialized(false){};
 
 void Processor::initialize(const std::filesystem::path &rom) {
+  m_mapping_controller->load_rom(rom);
+  reset();
+}
+
+void Processor::initialize(const std::vector<uint8_t> &rom) {
+  m_mapping_controller->load_rom(rom);
+  reset();
+}
+
+void Processor::reset() {
   m_registers.status.interrupt_disable = 1;
   m_registers.status.decimal = 0;
   m_mapping_controller->initialize();
@@ -25,7 +39,6 @@ void Processor::initialize(const std::filesystem::path &rom) {
   // TODO: reset Timer Interrupt Request (TIQ)
   // TODO: Set low speed mode
   m_registers.status.memory_operation = 0;
-  m_mapping_controller->load_rom(rom);
   if (m_mos_6502_mode_enabled) {
     m_registers.program_counter.value = 0x0400;
   } else {
@@ -37,12 +50,16 @@ void Processor::initialize(const std::filesystem::path &rom) {
 }
 
 void Processor::trace(uint8_t opcode) {
-  spdlog::get(LOGGER_NAME)
-      ->trace(fmt::format("PC: {:#06x} OP: {:#04x} A: {:#04x} X: {:#04x} Y: "
-                          "{:#04x} SP: {:#04x} P: {:#04x}",
-                          m_registers.program_counter.value, opcode,
-                          m_registers.accumulator, m_registers.x, m_registers.y,
-                          m_registers.stack_pointer, m_registers.status.value));
+  auto logger = spdlog::get(LOGGER_NAME);
+  if (!logger->should_log(spdlog::level::trace)) {
+    return;
+  }
+  logger->trace(fmt::format(
+      "PC: {:#06x} OP: {:#04x} A: {:#04x} X: {:#04x} Y: {:#04x} SP: {:#04x} "
+      "P: {:#04x}",
+      m_registers.program_counter.value, opcode, m_registers.accumulator,
+      m_registers.x, m_registers.y, m_registers.stack_pointer,
+      m_registers.status.value));
 }
 
 auto Processor::fetch_instruction() -> uint8_t {
@@ -241,9 +258,9 @@ auto RESET_VECTOR_FOR_INTERRUPT(Interrupt::RequestField field) -> uint16_t {
   }
 }
 
-void Processor::check_interrupts() {
+auto Processor::check_interrupts() -> bool {
   if (m_registers.status.interrupt_disable) {
-    return;
+    return false;
   }
   // In order of priotity:
   // TODO: Check reset
@@ -252,7 +269,7 @@ void Processor::check_interrupts() {
 
   Interrupt::RequestField field = m_interrupt_controller->priority_request();
   if (field == Interrupt::RequestField::None) {
-    return;
+    return false;
   }
 
   push_into_stack(m_registers.program_counter.program_counter_high);
@@ -268,4 +285,55 @@ void Processor::check_interrupts() {
       m_mapping_controller->load(reset_vector + 1);
   m_registers.program_counter.program_counter_low =
       m_mapping_controller->load(reset_vector);
+  return true;
+}
+
+void Processor::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  // One field at a time, the padding in Registers would make snapshots of the
+  // same state differ
+  writer.write(m_registers.accumulator);
+  writer.write(m_registers.x);
+  writer.write(m_registers.y);
+  writer.write(m_registers.program_counter.value);
+  writer.write(m_registers.stack_pointer);
+  writer.write(m_registers.status.value);
+  writer.write(m_registers.source_high);
+  writer.write(m_registers.destination_high);
+  writer.write(m_registers.length_high);
+  writer.write(m_speed);
+  writer.write(m_stack_pointer_initialized);
+  // Bottom to top, the fallback stack is empty once the stack pointer is set
+  std::stack<uint8_t> stack = m_fallback_stack;
+  std::vector<uint8_t> values(stack.size());
+  for (auto value = values.rbegin(); value != values.rend(); ++value) {
+    *value = stack.top();
+    stack.pop();
+  }
+  writer.write(static_cast<uint32_t>(values.size()));
+  writer.write_bytes(values.data(), values.size());
+  writer.end_section();
+}
+
+void Processor::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_registers.accumulator);
+  reader.read(m_registers.x);
+  reader.read(m_registers.y);
+  reader.read(m_registers.program_counter.value);
+  reader.read(m_registers.stack_pointer);
+  reader.read(m_registers.status.value);
+  reader.read(m_registers.source_high);
+  reader.read(m_registers.destination_high);
+  reader.read(m_registers.length_high);
+  reader.read(m_speed);
+  reader.read(m_stack_pointer_initialized);
+  uint32_t size = 0;
+  reader.read(size);
+  m_fallback_stack = std::stack<uint8_t>();
+  for (uint32_t i = 0; i < size && reader.is_valid(); i++) {
+    uint8_t value = 0;
+    reader.read(value);
+    m_fallback_stack.push(value);
+  }
 }
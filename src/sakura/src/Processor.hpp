@@ -5,9 +5,12 @@
 #include <filesystem>
 #include <memory>
 #include <stack>
+#include <vector>
 
 namespace Sakura {
 struct MOS6502ModeConfig;
+class StateReader;
+class StateWriter;
 namespace HuC6280 {
 namespace Interrupt {
 class Controller;
@@ -109,6 +112,7 @@ private:
 
   [[nodiscard]] auto get_zero_page_address(uint8_t address) const -> uint16_t;
 
+  void reset();
   void trace(uint8_t opcode);
 
   // clang-format off
@@ -497,9 +501,19 @@ public:
   ~Processor() = default;
 
   void initialize(const std::filesystem::path &rom);
+  void initialize(const std::vector<uint8_t> &rom);
   auto fetch_instruction() -> uint8_t;
 
-  void check_interrupts();
+  // True when an interrupt was taken
+  auto check_interrupts() -> bool;
+
+  // For tools that drive instruction handlers directly
+  [[nodiscard]] auto get_registers() const -> const Registers & {
+    return m_registers;
+  }
+  void set_registers(const Registers &registers) { m_registers = registers; }
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 };
 }; // namespace HuC6280
 }; // namespace Sakura
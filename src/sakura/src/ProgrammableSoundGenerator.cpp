@@ -1,8 +1,65 @@
 #include "ProgrammableSoundGenerator.hpp"
+#include "State.hpp"
+#include "sakura/AudioRingBuffer.hpp"
+#include "sakura/Constants.hpp"
+#include <cmath>
 #include <spdlog/spdlog.h>
 
 using namespace Sakura::HuC6280::ProgrammableSoundGenerator;
 
+const uint32_t G_CYCLES_PER_BLOCK = CYCLES_PER_SECOND / 100;
+// Longest instruction that can overshoot the end of a block
+const uint32_t G_MAX_CYCLES_PER_BLOCK = G_CYCLES_PER_BLOCK + 0xFF;
+// The PSG is clocked at 3.58 MHz
+const uint32_t G_CYCLES_PER_PSG_CLOCK = 6;
+const unsigned int G_WAVEFORM_MASK = WAVEFORM_LENGTH - 1;
+const unsigned int G_REGISTER_WRITES_CAPACITY = 1024;
+const float G_CENTER = 15.5F;
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("PSG ");
+const float G_CHANNEL_SCALE = 1.0F / (G_CENTER * NUMBER_OF_CHANNELS);
+
+// Every step of channel volume attenuates 1.5 dB, every step of balance and
+// main volume attenuates 3 dB
+const unsigned int G_ATTENUATION_STEPS = 0x1F + 0xF * 2 + 0xF * 2 + 1;
+const std::array<float, G_ATTENUATION_STEPS> G_ATTENUATION = [] {
+  std::array<float, G_ATTENUATION_STEPS> attenuation = {};
+  for (unsigned int i = 0; i < G_ATTENUATION_STEPS; i++) {
+    attenuation[i] = std::pow(10.0F, -1.5F * i / 20.0F) * G_CHANNEL_SCALE;
+  }
+  return attenuation;
+}();
+
+auto GET_GAIN(uint8_t al, uint8_t balance, uint8_t main) -> float {
+  return G_ATTENUATION[(0x1F - al) + (0xF - balance) * 2 + (0xF - main) * 2];
+}
+
+auto GET_WAVEFORM_PERIOD(uint16_t frequency) -> uint32_t {
+  if (frequency == 0) {
+    frequency = 0x1000;
+  }
+  return frequency * G_CYCLES_PER_PSG_CLOCK;
+}
+
+auto GET_NOISE_PERIOD(uint8_t nf) -> uint32_t {
+  uint32_t clocks = nf == 0x1F ? 32 : (nf ^ 0x1F) * 64;
+  return clocks * G_CYCLES_PER_PSG_CLOCK;
+}
+
+void STEP_NOISE(Channel &channel) {
+  uint32_t shift_register = channel.noise_shift_register;
+  uint32_t bit = (shift_register ^ (shift_register >> 1) ^
+                  (shift_register >> 11) ^ (shift_register >> 12) ^
+                  (shift_register >> 17)) &
+                 1;
+  channel.noise_shift_register = (shift_register >> 1) | (bit << 17);
+}
+
+Controller::Controller()
+    : m_low_frequency_oscillator_frequency(), m_channels(), m_cycles() {
+  m_register_writes.reserve(G_REGISTER_WRITES_CAPACITY);
+  set_sample_rate(AUDIO_SAMPLE_RATE);
+}
+
 auto Controller::load(uint16_t offset) const -> uint8_t {
   switch (offset & 0b1111) {
   case 0b0000:
@@ -15,9 +72,7 @@ auto Controller::load(uint16_t offset) const -> uint8_t {
   case 0b0101:
   case 0b0110:
   case 0b0111:
-    spdlog::get(LOGGER_NAME)
-        ->warn(fmt::format(
-            "Unimplemented HuC6280 PSG load with offset: {:#06x}", offset));
+    // Channel registers are write only
     return 0xFF;
   case 0b1000:
     return m_low_frequency_oscillator_frequency;
@@ -32,35 +87,314 @@ auto Controller::load(uint16_t offset) const -> uint8_t {
 }
 
 void Controller::store(uint16_t offset, uint8_t value) {
-  switch (offset & 0b1111) {
+  if ((offset & 0b1111) > 0b1001) {
+    spdlog::get(LOGGER_NAME)
+        ->critical(fmt::format(
+            "Unhandled HuC6280 PSG store with offset: {:#06x}, value: {:#04x}",
+            offset, value));
+    exit(1); // NOLINT(concurrency-mt-unsafe)
+  }
+  m_register_writes.push_back(
+      {m_cycles, static_cast<uint8_t>(offset & 0b1111), value});
+}
+
+void Controller::step(uint8_t cycles) {
+  m_cycles += cycles;
+  if (m_cycles >= G_CYCLES_PER_BLOCK) {
+    render_block();
+  }
+}
+
+void Controller::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_main_amplitude_level_adjustment);
+  writer.write(m_low_frequency_oscillator_frequency);
+  writer.write(m_low_frequency_oscillator_control);
+  writer.write(m_channel_select);
+  writer.write(m_channels);
+  writer.write(m_cycles);
+  writer.write(static_cast<uint32_t>(m_register_writes.size()));
+  // One field at a time, RegisterWrite is padded
+  for (const auto &register_write : m_register_writes) {
+    writer.write(register_write.cycle);
+    writer.write(register_write.offset);
+    writer.write(register_write.value);
+  }
+  writer.end_section();
+}
+
+void Controller::load_state(StateReader &reader) {
+  float left = 0.0F;
+  float right = 0.0F;
+  for (const auto &channel : m_channels) {
+    left -= channel.left_output;
+    right -= channel.right_output;
+  }
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_main_amplitude_level_adjustment);
+  reader.read(m_low_frequency_oscillator_frequency);
+  reader.read(m_low_frequency_oscillator_control);
+  reader.read(m_channel_select);
+  reader.read(m_channels);
+  reader.read(m_cycles);
+  uint32_t size = 0;
+  reader.read(size);
+  m_register_writes.clear();
+  for (uint32_t i = 0; i < size && reader.is_valid(); i++) {
+    RegisterWrite register_write = {};
+    reader.read(register_write.cycle);
+    reader.read(register_write.offset);
+    reader.read(register_write.value);
+    m_register_writes.push_back(register_write);
+  }
+  // The resampler is not part of the state, it only has to move from the
+  // level it was playing to the level of the loaded channels
+  for (const auto &channel : m_channels) {
+    left += channel.left_output;
+    right += channel.right_output;
+  }
+  m_buffer.add_delta(0, left, right);
+}
+
+void Controller::set_sample_rate(unsigned int sample_rate) {
+  m_buffer.configure(CYCLES_PER_SECOND, sample_rate, G_MAX_CYCLES_PER_BLOCK);
+}
+
+void Controller::set_rate_adjustment(double ratio) {
+  m_buffer.set_ratio(ratio);
+}
+
+void Controller::set_audio_callback(
+    const std::function<void(const std::vector<float> &)> &audio_callback) {
+  m_audio_callback = audio_callback;
+}
+
+void Controller::set_int16_audio_callback(
+    const std::function<void(const std::vector<int16_t> &)>
+        &int16_audio_callback) {
+  m_int16_audio_callback = int16_audio_callback;
+}
+
+void Controller::attach_audio_ring_buffer(
+    const std::shared_ptr<AudioRingBuffer> &ring_buffer) {
+  m_audio_ring_buffers.push_back(ring_buffer);
+}
+
+void Controller::apply(const RegisterWrite &register_write) {
+  uint8_t value = register_write.value;
+  switch (register_write.offset) {
   case 0b0000:
     m_channel_select.value = value;
-    break;
+    return;
   case 0b0001:
     m_main_amplitude_level_adjustment.value = value;
+    return;
+  case 0b1000:
+    m_low_frequency_oscillator_frequency = value;
+    return;
+  case 0b1001:
+    m_low_frequency_oscillator_control.value = value;
+    if (m_low_frequency_oscillator_control.lf_trg) {
+      m_channels[1].waveform_index = 0;
+    }
+    return;
+  default:
     break;
+  }
+
+  if (m_channel_select.ch_sel >= NUMBER_OF_CHANNELS) {
+    return;
+  }
+  Channel &channel = m_channels[m_channel_select.ch_sel];
+  switch (register_write.offset) {
   case 0b0010:
+    channel.frequency.low = value;
+    break;
   case 0b0011:
+    channel.frequency.high = value & 0b1111;
+    break;
   case 0b0100:
+    channel.control.value = value;
+    if (channel.control.dda && !channel.control.ch_on) {
+      channel.waveform_write_index = 0;
+    }
+    break;
   case 0b0101:
-  case 0b0110:
-  case 0b0111:
-    spdlog::get(LOGGER_NAME)
-        ->warn(fmt::format("Unimplemented HuC6280 PSG store "
-                           "with offset: {:#06x}, value: {:#04x}",
-                           offset, value));
+    channel.balance.value = value;
     break;
-  case 0b1000:
-    m_low_frequency_oscillator_frequency = value;
+  case 0b0110:
+    if (channel.control.dda) {
+      channel.direct_output = value & 0x1F;
+    } else if (!channel.control.ch_on) {
+      channel.waveform[channel.waveform_write_index] = value & 0x1F;
+      channel.waveform_write_index =
+          (channel.waveform_write_index + 1) & G_WAVEFORM_MASK;
+    }
     break;
-  case 0b1001:
-    m_low_frequency_oscillator_control.value = value;
+  case 0b0111:
+    channel.noise_control.value = value;
     break;
   default:
-    spdlog::get(LOGGER_NAME)
-        ->critical(fmt::format(
-            "Unhandled HuC6280 PSG store with offset: {:#06x}, value: {:#04x}",
-            offset, value));
-    exit(1); // NOLINT(concurrency-mt-unsafe)
+    break;
+  }
+}
+
+void Controller::set_output(Channel &channel, uint32_t time, float left,
+                            float right) {
+  if (left == channel.left_output && right == channel.right_output) {
+    return;
+  }
+  m_buffer.add_delta(time, left - channel.left_output,
+                     right - channel.right_output);
+  channel.left_output = left;
+  channel.right_output = right;
+}
+
+void Controller::render_channel(unsigned int index, uint32_t start,
+                                uint32_t end) {
+  Channel &channel = m_channels[index];
+  if (!channel.control.ch_on) {
+    set_output(channel, start, 0.0F, 0.0F);
+    return;
+  }
+  float left = GET_GAIN(channel.control.al, channel.balance.lal,
+                        m_main_amplitude_level_adjustment.lmal);
+  float right = GET_GAIN(channel.control.al, channel.balance.ral,
+                         m_main_amplitude_level_adjustment.rmal);
+
+  if (channel.control.dda) {
+    float output = channel.direct_output - G_CENTER;
+    set_output(channel, start, output * left, output * right);
+    return;
+  }
+
+  if (index >= 4 && channel.noise_control.ne) {
+    uint32_t period = GET_NOISE_PERIOD(channel.noise_control.nf);
+    float output =
+        ((channel.noise_shift_register & 1) != 0U ? 0x1F : 0) - G_CENTER;
+    set_output(channel, start, output * left, output * right);
+    uint32_t time = start + channel.counter;
+    while (time < end) {
+      STEP_NOISE(channel);
+      output = ((channel.noise_shift_register & 1) != 0U ? 0x1F : 0) - G_CENTER;
+      set_output(channel, time, output * left, output * right);
+      time += period;
+    }
+    channel.counter = time - end;
+    return;
+  }
+
+  uint32_t period = GET_WAVEFORM_PERIOD(channel.frequency.frequency);
+  float output = channel.waveform[channel.waveform_index] - G_CENTER;
+  set_output(channel, start, output * left, output * right);
+  uint32_t time = start + channel.counter;
+  while (time < end) {
+    channel.waveform_index = (channel.waveform_index + 1) & G_WAVEFORM_MASK;
+    output = channel.waveform[channel.waveform_index] - G_CENTER;
+    set_output(channel, time, output * left, output * right);
+    time += period;
+  }
+  channel.counter = time - end;
+}
+
+// With the LFO enabled channel 2 is muted and its waveform modulates the
+// frequency of channel 1, both run in lockstep
+void Controller::render_modulated_channel(uint32_t start, uint32_t end) {
+  Channel &channel = m_channels[0];
+  Channel &modulator = m_channels[1];
+  set_output(modulator, start, 0.0F, 0.0F);
+
+  uint8_t lfo_frequency = m_low_frequency_oscillator_frequency;
+  uint32_t modulator_period =
+      GET_WAVEFORM_PERIOD(modulator.frequency.frequency) *
+      (lfo_frequency == 0 ? 0x100 : lfo_frequency);
+  bool halted = m_low_frequency_oscillator_control.lf_trg;
+  uint32_t modulator_time = halted ? UINT32_MAX : start + modulator.counter;
+
+  bool playing = channel.control.ch_on && !channel.control.dda;
+  if (!playing) {
+    render_channel(0, start, end);
+  }
+  float left = GET_GAIN(channel.control.al, channel.balance.lal,
+                        m_main_amplitude_level_adjustment.lmal);
+  float right = GET_GAIN(channel.control.al, channel.balance.ral,
+                         m_main_amplitude_level_adjustment.rmal);
+  int multiplier = 1 << ((m_low_frequency_oscillator_control.lf_ctl - 1) << 1);
+
+  uint32_t time = UINT32_MAX;
+  if (playing) {
+    float output = channel.waveform[channel.waveform_index] - G_CENTER;
+    set_output(channel, start, output * left, output * right);
+    time = start + channel.counter;
+  }
+  for (;;) {
+    if (modulator_time < end && modulator_time <= time) {
+      modulator.waveform_index =
+          (modulator.waveform_index + 1) & G_WAVEFORM_MASK;
+      modulator_time += modulator_period;
+      continue;
+    }
+    if (time >= end) {
+      break;
+    }
+    channel.waveform_index = (channel.waveform_index + 1) & G_WAVEFORM_MASK;
+    float output = channel.waveform[channel.waveform_index] - G_CENTER;
+    set_output(channel, time, output * left, output * right);
+    int modulation =
+        (modulator.waveform[modulator.waveform_index] - 0x10) * multiplier;
+    time += GET_WAVEFORM_PERIOD((channel.frequency.frequency + modulation) &
+                                0xFFF);
+  }
+  if (playing) {
+    channel.counter = time - end;
+  }
+  if (!halted) {
+    modulator.counter = modulator_time - end;
+  }
+}
+
+void Controller::render(uint32_t start, uint32_t end) {
+  if (start >= end) {
+    return;
+  }
+  unsigned int index = 0;
+  if (m_low_frequency_oscillator_control.lf_ctl != 0) {
+    render_modulated_channel(start, end);
+    index = 2;
+  }
+  for (; index < NUMBER_OF_CHANNELS; index++) {
+    render_channel(index, start, end);
+  }
+}
+
+void Controller::render_block() {
+  uint32_t position = 0;
+  for (const auto &register_write : m_register_writes) {
+    render(position, register_write.cycle);
+    position = register_write.cycle;
+    apply(register_write);
+  }
+  render(position, m_cycles);
+  m_buffer.end_block(m_cycles);
+  m_register_writes.clear();
+  m_cycles = 0;
+
+  unsigned int count = m_buffer.get_samples_available();
+  m_samples.resize(count * 2);
+  m_buffer.read_samples(m_samples.data(), count);
+  if (m_audio_callback) {
+    m_audio_callback(m_samples);
+  }
+  if (!m_int16_audio_callback && m_audio_ring_buffers.empty()) {
+    return;
+  }
+  m_int16_samples.resize(count * 2);
+  BandLimitedBuffer::convert_samples(m_samples.data(), m_int16_samples.data(),
+                                     count * 2);
+  if (m_int16_audio_callback) {
+    m_int16_audio_callback(m_int16_samples);
+  }
+  for (auto &ring_buffer : m_audio_ring_buffers) {
+    ring_buffer->write(m_int16_samples.data(), count);
   }
 }
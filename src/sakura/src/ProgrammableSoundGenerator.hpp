@@ -1,17 +1,31 @@
 #ifndef SAKURA_PROGRAMMABLE_SOUND_GENERATOR_HPP
 #define SAKURA_PROGRAMMABLE_SOUND_GENERATOR_HPP
 
+#include "BandLimitedBuffer.hpp"
+#include <array>
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
+
+namespace Sakura {
+class AudioRingBuffer;
+class StateReader;
+class StateWriter;
+} // namespace Sakura
 
 namespace Sakura::HuC6280::ProgrammableSoundGenerator {
 
 static const std::string LOGGER_NAME = "huc6280_psg";
 
+const unsigned int NUMBER_OF_CHANNELS = 6;
+const unsigned int WAVEFORM_LENGTH = 32;
+
 union MainAmplitudeLevelAdjustment {
   struct {
-    uint8_t lmal : 4;
     uint8_t rmal : 4;
+    uint8_t lmal : 4;
   };
   uint8_t value;
 
@@ -41,19 +55,130 @@ union ChannelSelect {
   ChannelSelect() : value() {}
 };
 
+union Frequency {
+  struct {
+    uint16_t frequency : 12;
+    uint16_t unused : 4;
+  };
+  struct {
+    uint8_t low;
+    uint8_t high;
+  };
+  uint16_t value;
+
+  Frequency() : value() {}
+};
+
+union ChannelControl {
+  struct {
+    uint8_t al : 5;
+    uint8_t unused : 1;
+    uint8_t dda : 1;
+    uint8_t ch_on : 1;
+  };
+  uint8_t value;
+
+  ChannelControl() : value() {}
+};
+
+union ChannelBalance {
+  struct {
+    uint8_t ral : 4;
+    uint8_t lal : 4;
+  };
+  uint8_t value;
+
+  ChannelBalance() : value() {}
+};
+
+union NoiseControl {
+  struct {
+    uint8_t nf : 5;
+    uint8_t unused : 2;
+    uint8_t ne : 1;
+  };
+  uint8_t value;
+
+  NoiseControl() : value() {}
+};
+
+struct Channel {
+  Frequency frequency;
+  ChannelControl control;
+  ChannelBalance balance;
+  NoiseControl noise_control;
+  std::array<uint8_t, WAVEFORM_LENGTH> waveform;
+  uint8_t waveform_write_index;
+  uint8_t waveform_index;
+  uint8_t direct_output;
+  uint32_t noise_shift_register;
+  // Cycles left until the next waveform or noise step
+  uint32_t counter;
+  // Last amplitude added to the band limited buffer
+  float left_output;
+  float right_output;
+
+  Channel()
+      : waveform(), waveform_write_index(), waveform_index(), direct_output(),
+        noise_shift_register(1), counter(), left_output(), right_output() {}
+};
+
+struct RegisterWrite {
+  uint32_t cycle;
+  uint8_t offset;
+  uint8_t value;
+};
+
+/*
+Register writes are queued with the cycle they happened on and applied while
+rendering, so the CPU side only pays for a push_back. Once a block worth of
+cycles has elapsed the whole block is rendered channel by channel: each
+channel jumps from one waveform or noise step to the next and only adds a
+delta to the band limited buffer when its output changes. The resampled block
+is handed to the audio callbacks as interleaved stereo samples.
+*/
 class Controller {
 private:
   MainAmplitudeLevelAdjustment m_main_amplitude_level_adjustment;
   uint8_t m_low_frequency_oscillator_frequency;
   LowFrequencyOscillatorControl m_low_frequency_oscillator_control;
   ChannelSelect m_channel_select;
+  std::array<Channel, NUMBER_OF_CHANNELS> m_channels;
+
+  uint32_t m_cycles;
+  std::vector<RegisterWrite> m_register_writes;
+  BandLimitedBuffer m_buffer;
+  std::vector<float> m_samples;
+  std::vector<int16_t> m_int16_samples;
+  std::function<void(const std::vector<float> &)> m_audio_callback;
+  std::function<void(const std::vector<int16_t> &)> m_int16_audio_callback;
+  std::vector<std::shared_ptr<AudioRingBuffer>> m_audio_ring_buffers;
+
+  void apply(const RegisterWrite &register_write);
+  void set_output(Channel &channel, uint32_t time, float left, float right);
+  void render_channel(unsigned int index, uint32_t start, uint32_t end);
+  void render_modulated_channel(uint32_t start, uint32_t end);
+  void render(uint32_t start, uint32_t end);
+  void render_block();
 
 public:
-  Controller() = default;
+  Controller();
   ~Controller() = default;
 
   [[nodiscard]] auto load(uint16_t offset) const -> uint8_t;
   void store(uint16_t offset, uint8_t value);
+  void step(uint8_t cycles);
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
+  void set_sample_rate(unsigned int sample_rate);
+  void set_rate_adjustment(double ratio);
+  void set_audio_callback(
+      const std::function<void(const std::vector<float> &)> &audio_callback);
+  void set_int16_audio_callback(
+      const std::function<void(const std::vector<int16_t> &)>
+          &int16_audio_callback);
+  void
+  attach_audio_ring_buffer(const std::shared_ptr<AudioRingBuffer> &ring_buffer);
 };
 }; // namespace Sakura::HuC6280::ProgrammableSoundGenerator
 
@@ -15,10 +15,46 @@ auto RendererInfo::get_color_table_data()
   return m_video_color_encoder_controller->get_color_table_data();
 }
 
-auto RendererInfo::get_background_attribute_table_data()
-    -> std::array<float, BACKGROUND_ATTRIBUTE_TABLE_DATA_LENGTH> {
-  return m_video_display_controller->get_background_attribute_table_data();
+auto RendererInfo::get_background_attribute_table_data(
+    std::vector<DirtyRectangle> &dirty_rectangles)
+    -> const std::vector<float> & {
+  return m_video_display_controller->get_background_attribute_table_data(
+      dirty_rectangles);
 }
+
+auto RendererInfo::get_background_attribute_table_dimensions()
+    -> std::pair<unsigned int, unsigned int> {
+  return m_video_display_controller
+      ->get_background_attribute_table_dimensions();
+}
+
+auto RendererInfo::get_frame_buffer_data()
+    -> std::array<float, FRAME_BUFFER_DATA_LENGTH> {
+  std::array<float, FRAME_BUFFER_DATA_LENGTH> frame_buffer_data = {};
+  auto color_table_data =
+      m_video_color_encoder_controller->get_color_table_data();
+  const auto &frame_buffer = m_video_display_controller->get_frame_buffer();
+  auto [width, height] =
+      m_video_display_controller->get_frame_buffer_dimensions();
+  for (unsigned int i = 0; i < width * height; i++) {
+    unsigned int color_index = frame_buffer[i] * 3;
+    frame_buffer_data[i * 3] = color_table_data[color_index];
+    frame_buffer_data[i * 3 + 1] = color_table_data[color_index + 1];
+    frame_buffer_data[i * 3 + 2] = color_table_data[color_index + 2];
+  }
+  return frame_buffer_data;
+}
+
+auto RendererInfo::get_frame_buffer_dimensions()
+    -> std::pair<unsigned int, unsigned int> {
+  return m_video_display_controller->get_frame_buffer_dimensions();
+}
+
+auto RendererInfo::get_vram_data()
+    -> const std::array<uint16_t, VRAM_LENGTH> & {
+  return m_video_display_controller->get_vram();
+}
+
 auto RendererInfo::get_character_generator_data()
     -> std::array<float, CHARACTER_GENERATOR_DATA_LENGTH> {
   return m_video_display_controller->get_character_generator_data();
@@ -0,0 +1,162 @@
+#include "sakura/RewindBuffer.hpp"
+#include "sakura/Emulator.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+using namespace Sakura;
+
+// Deltas are encoded in words of 8 bytes as runs of zero words followed by
+// runs of literal words, each pair behind a header of two 16-bit lengths
+const size_t G_WORD_LENGTH = sizeof(uint64_t);
+const size_t G_MAX_RUN = 0xFFFF;
+const size_t G_HEADER_LENGTH = sizeof(uint16_t) * 2;
+
+// Bytes past the end of a snapshot read as zero
+auto LOAD_WORD(const std::vector<uint8_t> &data, size_t offset) -> uint64_t {
+  uint64_t word = 0;
+  if (offset + G_WORD_LENGTH <= data.size()) {
+    std::memcpy(&word, data.data() + offset, G_WORD_LENGTH);
+  } else if (offset < data.size()) {
+    std::memcpy(&word, data.data() + offset, data.size() - offset);
+  }
+  return word;
+}
+
+void XOR_WORD(std::vector<uint8_t> &data, size_t offset, uint64_t delta) {
+  size_t length = std::min(G_WORD_LENGTH, data.size() - offset);
+  uint64_t word = 0;
+  std::memcpy(&word, data.data() + offset, length);
+  word ^= delta;
+  std::memcpy(data.data() + offset, &word, length);
+}
+
+RewindBuffer::RewindBuffer(size_t capacity, unsigned int interval)
+    : m_arena(capacity), m_head(), m_interval(std::max(interval, 1U)),
+      m_frames() {}
+
+void RewindBuffer::push(const Emulator &emulator) {
+  if (m_frames++ % m_interval != 0) {
+    return;
+  }
+  emulator.save_state(m_snapshot);
+  if (!m_latest.empty()) {
+    push_delta(m_latest.size());
+  }
+  std::swap(m_latest, m_snapshot);
+}
+
+void RewindBuffer::push_delta(size_t state_length) {
+  size_t words = (state_length + G_WORD_LENGTH - 1) / G_WORD_LENGTH;
+  m_delta.clear();
+  size_t word = 0;
+  while (word < words) {
+    uint64_t delta = 0;
+    size_t zeros = 0;
+    while (word < words && zeros < G_MAX_RUN) {
+      size_t offset = word * G_WORD_LENGTH;
+      delta = LOAD_WORD(m_latest, offset) ^ LOAD_WORD(m_snapshot, offset);
+      if (delta != 0) {
+        break;
+      }
+      zeros++;
+      word++;
+    }
+    size_t header = m_delta.size();
+    m_delta.resize(header + G_HEADER_LENGTH);
+    size_t literals = 0;
+    while (word < words && literals < G_MAX_RUN && zeros < G_MAX_RUN) {
+      size_t offset = word * G_WORD_LENGTH;
+      delta = LOAD_WORD(m_latest, offset) ^ LOAD_WORD(m_snapshot, offset);
+      if (delta == 0) {
+        break;
+      }
+      size_t end = m_delta.size();
+      m_delta.resize(end + G_WORD_LENGTH);
+      std::memcpy(m_delta.data() + end, &delta, G_WORD_LENGTH);
+      literals++;
+      word++;
+    }
+    std::array<uint16_t, 2> lengths = {static_cast<uint16_t>(zeros),
+                                       static_cast<uint16_t>(literals)};
+    std::memcpy(m_delta.data() + header, lengths.data(), G_HEADER_LENGTH);
+  }
+
+  size_t length = m_delta.size();
+  if (length > m_arena.size()) {
+    // The history before this snapshot can no longer be reached
+    m_entries.clear();
+    m_head = 0;
+    return;
+  }
+  if (m_head + length > m_arena.size()) {
+    m_head = 0;
+  }
+  drop_overlapping_entries(m_head, length);
+  std::memcpy(m_arena.data() + m_head, m_delta.data(), length);
+  m_entries.push_back(
+      {.offset = m_head, .length = length, .state_length = state_length});
+  m_head += length;
+}
+
+void RewindBuffer::drop_overlapping_entries(size_t offset, size_t length) {
+  // Every entry older than an overwritten one is unreachable as well
+  auto newest = std::find_if(
+      m_entries.rbegin(), m_entries.rend(), [=](const Entry &entry) {
+        return entry.offset < offset + length &&
+               offset < entry.offset + entry.length;
+      });
+  m_entries.erase(m_entries.begin(), newest.base());
+}
+
+auto RewindBuffer::rewind(Emulator &emulator) -> bool {
+  if (m_latest.empty() || !emulator.load_state(m_latest)) {
+    return false;
+  }
+  m_frames = 1;
+  if (m_entries.empty()) {
+    return true;
+  }
+  Entry entry = m_entries.back();
+  m_entries.pop_back();
+  m_head = entry.offset;
+
+  m_latest.resize(entry.state_length);
+  const uint8_t *delta = m_arena.data() + entry.offset;
+  const uint8_t *end = delta + entry.length;
+  size_t word = 0;
+  while (delta < end) {
+    std::array<uint16_t, 2> lengths = {};
+    std::memcpy(lengths.data(), delta, G_HEADER_LENGTH);
+    delta += G_HEADER_LENGTH;
+    word += lengths[0];
+    for (unsigned int i = 0; i < lengths[1]; i++) {
+      uint64_t value = 0;
+      std::memcpy(&value, delta, G_WORD_LENGTH);
+      delta += G_WORD_LENGTH;
+      XOR_WORD(m_latest, word * G_WORD_LENGTH, value);
+      word++;
+    }
+  }
+  return true;
+}
+
+void RewindBuffer::clear() {
+  m_entries.clear();
+  m_head = 0;
+  m_frames = 0;
+  m_latest.clear();
+}
+
+auto RewindBuffer::get_count() const -> size_t {
+  return m_latest.empty() ? 0 : m_entries.size() + 1;
+}
+
+auto RewindBuffer::get_used_bytes() const -> size_t {
+  size_t used = 0;
+  for (const auto &entry : m_entries) {
+    used += entry.length;
+  }
+  return used;
+}
@@ -0,0 +1,118 @@
+#include "SpriteAttributeTable.hpp"
+#include "State.hpp"
+#include <algorithm>
+
+using namespace Sakura::HuC6270;
+
+const int G_SPRITE_X_OFFSET = 32;
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("SAT ");
+
+SpriteAttributeTable::SpriteAttributeTable()
+    : m_SAT(), m_sprites(), m_scanline_sprites(), m_over(), m_collision() {
+  decode_sprites();
+  build_scanline_sprites();
+}
+
+auto SpriteAttributeTable::transfer(const std::array<uint16_t, 0x8000> &vram,
+                                    uint16_t source) -> bool {
+  bool changed = false;
+  for (unsigned int i = 0; i < SPRITE_ATTRIBUTE_TABLE_LENGTH; i++) {
+    uint16_t word = vram[(source + i) & 0x7FFF];
+    if (m_SAT[i] != word) {
+      m_SAT[i] = word;
+      changed = true;
+    }
+  }
+  if (changed) {
+    decode_sprites();
+    build_scanline_sprites();
+  }
+  return changed;
+}
+
+void SpriteAttributeTable::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_SAT);
+  writer.end_section();
+}
+
+void SpriteAttributeTable::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_SAT);
+  // Decoded sprites are derived from the table and not part of the state
+  decode_sprites();
+  build_scanline_sprites();
+}
+
+void SpriteAttributeTable::decode_sprites() {
+  for (unsigned int i = 0; i < SPRITE_ATTRIBUTE_TABLE_NUMBER_OF_SPRITES; i++) {
+    unsigned int base = i * SPRITE_ATTRIBUTE_TABLE_WORDS_PER_SPRITE;
+    auto flags = SpriteAttributeFlags(m_SAT[base + 3]);
+    uint16_t pattern_code = (m_SAT[base + 2] >> 1) & 0x3FF;
+    // Wider and taller sprites are made of consecutive cells, so the low bits
+    // of the pattern code are ignored by the hardware
+    if (flags.cgx != 0) {
+      pattern_code &= ~0b1;
+    }
+    if (flags.cgy == 0b01) {
+      pattern_code &= ~0b10;
+    } else if (flags.cgy != 0b00) {
+      pattern_code &= ~0b110;
+    }
+
+    Sprite &sprite = m_sprites[i];
+    sprite.y = static_cast<int>(m_SAT[base] & 0x3FF) -
+               static_cast<int>(SPRITE_COORDINATE_OFFSET);
+    sprite.x = static_cast<int>(m_SAT[base + 1] & 0x3FF) - G_SPRITE_X_OFFSET;
+    sprite.pattern_address = pattern_code << 6;
+    unsigned int height_cells = 4;
+    if (flags.cgy == 0b00) {
+      height_cells = 1;
+    } else if (flags.cgy == 0b01) {
+      height_cells = 2;
+    }
+    sprite.width = SPRITE_CELL_DOTS_WIDTH << flags.cgx;
+    sprite.height = SPRITE_CELL_DOTS_HEIGHT * height_cells;
+    sprite.flags = flags;
+  }
+}
+
+void SpriteAttributeTable::build_scanline_sprites() {
+  for (auto &scanline : m_scanline_sprites) {
+    scanline.count = 0;
+    scanline.cells = 0;
+  }
+  m_over = false;
+  m_collision = false;
+
+  const Sprite &first = m_sprites[0];
+  for (unsigned int i = 0; i < SPRITE_ATTRIBUTE_TABLE_NUMBER_OF_SPRITES; i++) {
+    const Sprite &sprite = m_sprites[i];
+    int top = std::max(sprite.y, 0);
+    int bottom = std::min(sprite.y + static_cast<int>(sprite.height),
+                          static_cast<int>(SPRITE_NUMBER_OF_SCANLINES));
+    if (top >= bottom) {
+      continue;
+    }
+    uint8_t cells = sprite.width / SPRITE_CELL_DOTS_WIDTH;
+    for (int line = top; line < bottom; line++) {
+      ScanlineSprites &scanline = m_scanline_sprites[line];
+      if (scanline.cells + cells > SPRITE_MAX_CELLS_PER_SCANLINE) {
+        m_over = true;
+        continue;
+      }
+      scanline.indexes[scanline.count] = i;
+      scanline.count++;
+      scanline.cells += cells;
+    }
+
+    // Collision is detected between sprite #0 and any other sprite, here we
+    // approximate it with their bounding boxes
+    if (i != 0 && sprite.y < first.y + static_cast<int>(first.height) &&
+        first.y < sprite.y + static_cast<int>(sprite.height) &&
+        sprite.x < first.x + static_cast<int>(first.width) &&
+        first.x < sprite.x + static_cast<int>(sprite.width)) {
+      m_collision = true;
+    }
+  }
+}
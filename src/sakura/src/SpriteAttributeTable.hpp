@@ -0,0 +1,94 @@
+#ifndef SAKURA_SPRITE_ATTRIBUTE_TABLE_HPP
+#define SAKURA_SPRITE_ATTRIBUTE_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace Sakura {
+class StateReader;
+class StateWriter;
+} // namespace Sakura
+
+namespace Sakura::HuC6270 {
+
+constexpr unsigned int SPRITE_ATTRIBUTE_TABLE_NUMBER_OF_SPRITES = 64;
+constexpr unsigned int SPRITE_ATTRIBUTE_TABLE_WORDS_PER_SPRITE = 4;
+constexpr unsigned int SPRITE_ATTRIBUTE_TABLE_LENGTH =
+    SPRITE_ATTRIBUTE_TABLE_NUMBER_OF_SPRITES *
+    SPRITE_ATTRIBUTE_TABLE_WORDS_PER_SPRITE;
+
+constexpr unsigned int SPRITE_CELL_DOTS_WIDTH = 16;
+constexpr unsigned int SPRITE_CELL_DOTS_HEIGHT = 16;
+constexpr unsigned int SPRITE_MAX_CELLS_PER_SCANLINE = 16;
+// Sprite coordinates are relative to the raster counter, which is 64 on the
+// first line of the active display area
+constexpr unsigned int SPRITE_COORDINATE_OFFSET = 64;
+constexpr unsigned int SPRITE_NUMBER_OF_SCANLINES = 263;
+
+union SpriteAttributeFlags {
+  struct {
+    uint16_t color_area : 4;
+    uint16_t unused : 3;
+    uint16_t priority : 1;
+    uint16_t cgx : 1;
+    uint16_t unused_2 : 2;
+    uint16_t x_invert : 1;
+    uint16_t cgy : 2;
+    uint16_t unused_3 : 1;
+    uint16_t y_invert : 1;
+  };
+  uint16_t value;
+
+  SpriteAttributeFlags() : value() {}
+  SpriteAttributeFlags(uint16_t value) : value(value) {}
+};
+
+struct Sprite {
+  int y;
+  int x;
+  uint16_t pattern_address;
+  unsigned int width;
+  unsigned int height;
+  SpriteAttributeFlags flags;
+};
+
+struct ScanlineSprites {
+  std::array<uint8_t, SPRITE_MAX_CELLS_PER_SCANLINE> indexes;
+  uint8_t count;
+  uint8_t cells;
+};
+
+class SpriteAttributeTable {
+private:
+  std::array<uint16_t, SPRITE_ATTRIBUTE_TABLE_LENGTH> m_SAT;
+  std::array<Sprite, SPRITE_ATTRIBUTE_TABLE_NUMBER_OF_SPRITES> m_sprites;
+  std::array<ScanlineSprites, SPRITE_NUMBER_OF_SCANLINES> m_scanline_sprites;
+
+  bool m_over;
+  bool m_collision;
+
+  void decode_sprites();
+  void build_scanline_sprites();
+
+public:
+  SpriteAttributeTable();
+  ~SpriteAttributeTable() = default;
+
+  auto transfer(const std::array<uint16_t, 0x8000> &vram, uint16_t source)
+      -> bool;
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
+
+  [[nodiscard]] auto get_sprite(unsigned int index) const -> const Sprite & {
+    return m_sprites[index];
+  }
+  [[nodiscard]] auto get_scanline_sprites(unsigned int line) const
+      -> const ScanlineSprites & {
+    return m_scanline_sprites[line];
+  }
+  [[nodiscard]] auto is_over() const -> bool { return m_over; }
+  [[nodiscard]] auto is_collision() const -> bool { return m_collision; }
+};
+}; // namespace Sakura::HuC6270
+
+#endif
@@ -0,0 +1,82 @@
+#include "State.hpp"
+#include <cstring>
+
+using namespace Sakura;
+
+const size_t G_HEADER_LENGTH = sizeof(uint32_t) * 2;
+const size_t G_SECTION_HEADER_LENGTH = sizeof(uint32_t) * 2;
+
+auto LOAD_UINT32(const std::vector<uint8_t> &data, size_t position)
+    -> uint32_t {
+  uint32_t value = 0;
+  std::memcpy(&value, data.data() + position, sizeof(value));
+  return value;
+}
+
+StateWriter::StateWriter(std::vector<uint8_t> &data)
+    : m_data(data), m_section() {
+  m_data.clear();
+  write(STATE_MAGIC);
+  write(STATE_VERSION);
+}
+
+void StateWriter::begin_section(uint32_t tag) {
+  write(tag);
+  m_section = m_data.size();
+  write(uint32_t());
+}
+
+void StateWriter::end_section() {
+  auto size = static_cast<uint32_t>(m_data.size() - m_section -
+                                    sizeof(uint32_t));
+  std::memcpy(m_data.data() + m_section, &size, sizeof(size));
+}
+
+void StateWriter::write_bytes(const void *bytes, size_t length) {
+  size_t end = m_data.size();
+  m_data.resize(end + length);
+  std::memcpy(m_data.data() + end, bytes, length);
+}
+
+StateReader::StateReader(const std::vector<uint8_t> &data)
+    : m_data(data), m_position(), m_section_end(), m_valid() {
+  if (m_data.size() < G_HEADER_LENGTH ||
+      LOAD_UINT32(m_data, 0) != STATE_MAGIC ||
+      LOAD_UINT32(m_data, sizeof(uint32_t)) != STATE_VERSION) {
+    return;
+  }
+  size_t position = G_HEADER_LENGTH;
+  while (position + G_SECTION_HEADER_LENGTH <= m_data.size()) {
+    position += G_SECTION_HEADER_LENGTH +
+                LOAD_UINT32(m_data, position + sizeof(uint32_t));
+  }
+  m_valid = position == m_data.size();
+}
+
+auto StateReader::open_section(uint32_t tag) -> bool {
+  if (!m_valid) {
+    return false;
+  }
+  size_t position = G_HEADER_LENGTH;
+  while (position < m_data.size()) {
+    uint32_t size = LOAD_UINT32(m_data, position + sizeof(uint32_t));
+    position += G_SECTION_HEADER_LENGTH;
+    if (LOAD_UINT32(m_data, position - G_SECTION_HEADER_LENGTH) == tag) {
+      m_position = position;
+      m_section_end = position + size;
+      return true;
+    }
+    position += size;
+  }
+  m_valid = false;
+  return false;
+}
+
+void StateReader::read_bytes(void *bytes, size_t length) {
+  if (!m_valid || m_section_end - m_position < length) {
+    m_valid = false;
+    return;
+  }
+  std::memcpy(bytes, m_data.data() + m_position, length);
+  m_position += length;
+}
@@ -0,0 +1,76 @@
+#ifndef SAKURA_STATE_HPP
+#define SAKURA_STATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Sakura {
+
+constexpr uint32_t STATE_VERSION = 4;
+
+constexpr auto STATE_TAG(const char (&name)[5]) -> uint32_t {
+  return static_cast<uint32_t>(static_cast<uint8_t>(name[0])) |
+         static_cast<uint32_t>(static_cast<uint8_t>(name[1])) << 8 |
+         static_cast<uint32_t>(static_cast<uint8_t>(name[2])) << 16 |
+         static_cast<uint32_t>(static_cast<uint8_t>(name[3])) << 24;
+}
+
+constexpr uint32_t STATE_MAGIC = STATE_TAG("SKRA");
+
+/*
+Snapshots are a header (magic, version) followed by tagged sections, each one
+a tag, a payload size and the payload. Payloads are the raw bytes of the
+controller registers and memories in host byte order, so saving and loading
+are a handful of memcpy calls. Snapshots are only meant to be loaded by the
+same build on the same host, any layout change bumps STATE_VERSION.
+*/
+class StateWriter {
+private:
+  std::vector<uint8_t> &m_data;
+  size_t m_section;
+
+public:
+  // Clears data but keeps its capacity, so snapshots can reuse a buffer
+  explicit StateWriter(std::vector<uint8_t> &data);
+  ~StateWriter() = default;
+
+  void begin_section(uint32_t tag);
+  void end_section();
+  void write_bytes(const void *bytes, size_t length);
+
+  template <typename T> void write(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable values can be saved");
+    write_bytes(&value, sizeof(T));
+  }
+};
+
+class StateReader {
+private:
+  const std::vector<uint8_t> &m_data;
+  size_t m_position;
+  size_t m_section_end;
+  bool m_valid;
+
+public:
+  // Checks the header and that every section fits in data
+  explicit StateReader(const std::vector<uint8_t> &data);
+  ~StateReader() = default;
+
+  // Reads fail until a section is open
+  auto open_section(uint32_t tag) -> bool;
+  void read_bytes(void *bytes, size_t length);
+
+  template <typename T> void read(T &value) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable values can be loaded");
+    read_bytes(&value, sizeof(T));
+  }
+
+  [[nodiscard]] auto is_valid() const -> bool { return m_valid; }
+};
+}; // namespace Sakura
+
+#endif
@@ -0,0 +1,115 @@
+#include "sakura/Telemetry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fmt/core.h>
+
+using namespace Sakura;
+
+const std::array<const char *, TELEMETRY_NUMBER_OF_PHASES> G_PHASE_NAMES = {
+    "emulation", "vsync_callback", "render", "present"};
+
+Telemetry::Telemetry() : m_histograms() {}
+
+auto Telemetry::get_bucket(uint64_t nanoseconds) -> size_t {
+  // The first power of two is linear, one nanosecond per bucket
+  if (nanoseconds < (1ULL << SUB_BUCKET_BITS)) {
+    return nanoseconds;
+  }
+  unsigned int exponent = 63 - __builtin_clzll(nanoseconds);
+  if (exponent > MAX_EXPONENT) {
+    return NUMBER_OF_BUCKETS - 1;
+  }
+  uint64_t sub_bucket = (nanoseconds >> (exponent - SUB_BUCKET_BITS)) &
+                        ((1ULL << SUB_BUCKET_BITS) - 1);
+  return ((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + sub_bucket;
+}
+
+auto Telemetry::get_bucket_lower_bound(size_t bucket) -> uint64_t {
+  size_t octave = bucket >> SUB_BUCKET_BITS;
+  if (octave == 0) {
+    return bucket;
+  }
+  uint64_t sub_bucket = bucket & ((1ULL << SUB_BUCKET_BITS) - 1);
+  return ((1ULL << SUB_BUCKET_BITS) + sub_bucket) << (octave - 1);
+}
+
+auto Telemetry::get_bucket_upper_bound(size_t bucket) -> uint64_t {
+  size_t octave = bucket >> SUB_BUCKET_BITS;
+  return get_bucket_lower_bound(bucket) +
+         (octave == 0 ? 1 : 1ULL << (octave - 1));
+}
+
+void Telemetry::record(TelemetryPhase phase, Clock::duration duration) {
+  uint64_t nanoseconds = std::max<int64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+      0);
+  Histogram &histogram = m_histograms[static_cast<size_t>(phase)];
+  histogram.counts[get_bucket(nanoseconds)].fetch_add(
+      1, std::memory_order_relaxed);
+  histogram.frames.fetch_add(1, std::memory_order_relaxed);
+  uint64_t max = histogram.max.load(std::memory_order_relaxed);
+  while (nanoseconds > max &&
+         !histogram.max.compare_exchange_weak(max, nanoseconds,
+                                              std::memory_order_relaxed)) {
+  }
+}
+
+auto Telemetry::get_percentile(const Histogram &histogram, uint64_t frames,
+                               double percentile) const -> uint64_t {
+  if (frames == 0) {
+    return 0;
+  }
+  auto rank = static_cast<uint64_t>(
+      std::ceil(static_cast<double>(frames) * percentile));
+  uint64_t max = histogram.max.load(std::memory_order_relaxed);
+  uint64_t seen = 0;
+  for (size_t bucket = 0; bucket < NUMBER_OF_BUCKETS; bucket++) {
+    seen += histogram.counts[bucket].load(std::memory_order_relaxed);
+    if (seen >= std::max<uint64_t>(rank, 1)) {
+      return std::min(get_bucket_upper_bound(bucket), max);
+    }
+  }
+  return max;
+}
+
+auto Telemetry::get_statistics(TelemetryPhase phase) const
+    -> TelemetryStatistics {
+  const Histogram &histogram = m_histograms[static_cast<size_t>(phase)];
+  uint64_t frames = histogram.frames.load(std::memory_order_relaxed);
+  return {.frames = frames,
+          .p50 = get_percentile(histogram, frames, 0.50),
+          .p95 = get_percentile(histogram, frames, 0.95),
+          .p99 = get_percentile(histogram, frames, 0.99),
+          .max = histogram.max.load(std::memory_order_relaxed)};
+}
+
+auto Telemetry::get_csv() const -> std::string {
+  std::string csv = "phase,lower_ns,upper_ns,frames\n";
+  for (size_t phase = 0; phase < TELEMETRY_NUMBER_OF_PHASES; phase++) {
+    for (size_t bucket = 0; bucket < NUMBER_OF_BUCKETS; bucket++) {
+      uint64_t count =
+          m_histograms[phase].counts[bucket].load(std::memory_order_relaxed);
+      if (count == 0) {
+        continue;
+      }
+      csv += fmt::format("{},{},{},{}\n", G_PHASE_NAMES[phase],
+                         get_bucket_lower_bound(bucket),
+                         get_bucket_upper_bound(bucket), count);
+    }
+  }
+  return csv;
+}
+
+void Telemetry::reset() {
+  for (auto &histogram : m_histograms) {
+    for (auto &count : histogram.counts) {
+      count.store(0, std::memory_order_relaxed);
+    }
+    histogram.frames.store(0, std::memory_order_relaxed);
+    histogram.max.store(0, std::memory_order_relaxed);
+  }
+}
+
+auto Telemetry::get_phase_name(TelemetryPhase phase) -> const char * {
+  return G_PHASE_NAMES[static_cast<size_t>(phase)];
+}
@@ -1,10 +1,13 @@
 #include "Timer.hpp"
 #include "Interrupt.hpp"
+#include "State.hpp"
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
 
 using namespace Sakura::HuC6280::Timer;
 
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("TIMR");
+
 Controller::Controller(
     std::unique_ptr<Interrupt::Controller> &interrupt_controller)
     : m_total_cycles(), m_downcounter(),
@@ -65,3 +68,20 @@ void Controller::step(uint8_t cycles) {
     }
   }
 }
+
+void Controller::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_total_cycles);
+  writer.write(m_downcounter);
+  writer.write(m_control);
+  writer.write(m_reload);
+  writer.end_section();
+}
+
+void Controller::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_total_cycles);
+  reader.read(m_downcounter);
+  reader.read(m_control);
+  reader.read(m_reload);
+}
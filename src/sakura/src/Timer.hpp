@@ -5,6 +5,11 @@
 #include <memory>
 #include <string>
 
+namespace Sakura {
+class StateReader;
+class StateWriter;
+} // namespace Sakura
+
 namespace Sakura::HuC6280 {
 namespace Interrupt {
 class Controller;
@@ -52,6 +57,8 @@ public:
   void store(uint16_t offset, uint8_t value);
 
   void step(uint8_t cycles);
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 };
 }; // namespace Timer
 }; // namespace Sakura::HuC6280
@@ -0,0 +1,93 @@
+#include "sakura/TraceBuffer.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace Sakura;
+
+const std::array<char, 4> G_MAGIC = {'S', 'K', 'T', 'R'};
+const uint32_t G_VERSION = 1;
+
+TraceBuffer::TraceBuffer()
+    : m_mapping(), m_mapping_length(), m_header(), m_records(), m_mask() {}
+
+TraceBuffer::~TraceBuffer() { close(); }
+
+void TraceBuffer::close() {
+  if (m_mapping == nullptr) {
+    return;
+  }
+  munmap(m_mapping, m_mapping_length);
+  m_mapping = nullptr;
+  m_mapping_length = 0;
+  m_header = nullptr;
+  m_records = nullptr;
+  m_mask = 0;
+}
+
+auto TraceBuffer::open(const std::filesystem::path &path, size_t capacity)
+    -> bool {
+  close();
+  size_t records = 1;
+  while (records < capacity) {
+    records <<= 1;
+  }
+  size_t length = sizeof(TraceHeader) + records * sizeof(TraceRecord);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  int descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (descriptor < 0) {
+    return false;
+  }
+  if (ftruncate(descriptor, static_cast<off_t>(length)) != 0) {
+    ::close(descriptor);
+    return false;
+  }
+  void *mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       descriptor, 0);
+  // The mapping keeps the file open
+  ::close(descriptor);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  m_mapping = mapping;
+  m_mapping_length = length;
+  m_header = static_cast<TraceHeader *>(mapping);
+  m_records = reinterpret_cast<TraceRecord *>(m_header + 1);
+  m_mask = records - 1;
+  *m_header = {.magic = G_MAGIC,
+               .version = G_VERSION,
+               .record_size = sizeof(TraceRecord),
+               .reserved = 0,
+               .capacity = records,
+               .written = 0};
+  return true;
+}
+
+auto TraceBuffer::load(const std::filesystem::path &path,
+                       std::vector<TraceRecord> &records, uint64_t &skipped)
+    -> bool {
+  std::ifstream file = std::ifstream(path, std::ios::in | std::ios::binary);
+  TraceHeader header = {};
+  file.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!file || header.magic != G_MAGIC || header.version != G_VERSION ||
+      header.record_size != sizeof(TraceRecord) || header.capacity == 0 ||
+      (header.capacity & (header.capacity - 1)) != 0) {
+    return false;
+  }
+  std::vector<TraceRecord> ring(header.capacity);
+  file.read(reinterpret_cast<char *>(ring.data()),
+            static_cast<std::streamsize>(ring.size() * sizeof(TraceRecord)));
+  if (!file) {
+    return false;
+  }
+  uint64_t count = std::min(header.written, header.capacity);
+  records.clear();
+  records.reserve(count);
+  for (uint64_t i = header.written - count; i < header.written; i++) {
+    records.push_back(ring[i & (header.capacity - 1)]);
+  }
+  skipped = header.written - count;
+  return true;
+}
@@ -1,13 +1,17 @@
 #include "VideoColorEncoder.hpp"
+#include "State.hpp"
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
 
 using namespace Sakura::HuC6260;
 
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("VCE ");
+
 void Controller::store_color_table_ram() {
   auto entry = ColorTableEntry(m_color_table_data_write.value);
   m_color_table_RAM[m_color_table_address.cta] = entry;
   m_color_table_address.value++;
+  m_color_table_generation++;
 }
 
 auto Controller::load(uint16_t offset) const -> uint8_t {
@@ -71,6 +75,13 @@ auto Controller::get_color_table_data()
   return color_data;
 }
 
+void Controller::copy_color_table(
+    std::array<uint16_t, COLOR_TABLE_RAM_NUMBER_OF_COLORS> &color_table) const {
+  for (unsigned int i = 0; i < COLOR_TABLE_RAM_NUMBER_OF_COLORS; i++) {
+    color_table[i] = m_color_table_RAM[i].value;
+  }
+}
+
 auto Controller::get_color_data(uint16_t background, uint16_t color_area,
                                 uint16_t pattern_color)
     -> std::array<float, 3> {
@@ -80,3 +91,22 @@ auto Controller::get_color_data(uint16_t background, uint16_t color_area,
   auto entry = m_color_table_RAM[address];
   return {entry.r / 7.0F, entry.g / 7.0F, entry.b / 7.0F};
 }
+
+void Controller::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_color_table_RAM);
+  writer.write(m_color_table_address);
+  writer.write(m_color_table_data_write);
+  writer.write(m_control);
+  writer.end_section();
+}
+
+void Controller::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_color_table_RAM);
+  reader.read(m_color_table_address);
+  reader.read(m_color_table_data_write);
+  reader.read(m_control);
+  // Every cached conversion of the color table is stale
+  m_color_table_generation++;
+}
@@ -6,6 +6,11 @@
 #include <sakura/Constants.hpp>
 #include <string>
 
+namespace Sakura {
+class StateReader;
+class StateWriter;
+} // namespace Sakura
+
 namespace Sakura::HuC6260 {
 
 static const std::string LOGGER_NAME = "--huc6260--";
@@ -60,6 +65,7 @@ class Controller {
   ColorTableAddress m_color_table_address;
   ColorTableDataWrite m_color_table_data_write;
   uint8_t m_control;
+  uint32_t m_color_table_generation{};
 
   void store_color_table_ram();
 
@@ -69,8 +75,15 @@ public:
 
   [[nodiscard]] auto load(uint16_t offset) const -> uint8_t;
   void store(uint16_t offset, uint8_t value);
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 
+  [[nodiscard]] auto get_color_table_generation() const -> uint32_t {
+    return m_color_table_generation;
+  }
   auto get_color_table_data() -> std::array<float, COLOR_TABLE_RAM_DATA_LENGTH>;
+  void copy_color_table(std::array<uint16_t, COLOR_TABLE_RAM_NUMBER_OF_COLORS>
+                            &color_table) const;
   auto get_color_data(uint16_t background, uint16_t color_area,
                       uint16_t pattern_color) -> std::array<float, 3>;
 };
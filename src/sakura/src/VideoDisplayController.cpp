@@ -1,7 +1,11 @@
 #include "VideoDisplayController.hpp"
 #include "Interrupt.hpp"
+#include "State.hpp"
 #include "VideoColorEncoder.hpp"
 #include "sakura/Emulator.hpp"
+#include "sakura/FrameSink.hpp"
+#include "sakura/RendererInfo.hpp"
+#include <algorithm>
 #include <bitset>
 #include <cmath>
 #include <fmt/core.h>
@@ -10,21 +14,35 @@
 
 using namespace Sakura::HuC6270;
 
-const uint32_t G_HIGH_SPEED_CYCLES_PER_SECOND = 21477270;
-const double G_FRAME_RATE = 60.0;
 const uint32_t G_CYCLES_PER_FRAME =
-    ceil((float)G_HIGH_SPEED_CYCLES_PER_SECOND / G_FRAME_RATE);
+    ceil((float)CYCLES_PER_SECOND / FRAME_RATE);
+const uint32_t G_CYCLES_PER_SCANLINE =
+    G_CYCLES_PER_FRAME / SCANLINES_PER_FRAME;
+const uint32_t G_VRAM_VRAM_TRANSFER_CYCLES_PER_WORD = 4;
+// The raster counter is 64 on the first line of the active display area
+const unsigned int G_RASTER_COUNTER_OFFSET = 64;
+const uint16_t G_BACKGROUND_Y_MASK = 0x1FF;
+const uint32_t G_STATE_TAG = Sakura::STATE_TAG("VDC ");
 
 Controller::Controller(
     Sakura::VDCConfig config,
     std::unique_ptr<HuC6280::Interrupt::Controller> &interrupt_controller,
     std::unique_ptr<HuC6260::Controller> &video_color_encoder_controller)
-    : m_VRAM(), m_cycles(), m_interrupt_controller(interrupt_controller),
+    : m_VRAM(), m_scanline_cycles(), m_scanline(), m_display_start_scanline(),
+      m_display_end_scanline(), m_background_y_counter(),
+      m_block_transfer_vram_vram_cycles(),
+      m_block_transfer_vram_satb_pending(),
+      m_interrupt_controller(interrupt_controller),
       m_video_color_encoder_controller(video_color_encoder_controller),
-      m_state(std::make_unique<ControllerState>()), m_vsync_callback(nullptr) {
+      m_state(std::make_unique<ControllerState>()), m_scanline_registers(),
+      m_scanline_run_begin(), m_background_attribute_table_data(),
+      m_background_attribute_table_color_table_generation(),
+      m_vsync_callback(nullptr), m_frame_sequence() {
+  resize_background_attribute_table();
   if (config.deadbeef_vram) {
     m_VRAM.fill(0xDEAD);
   }
+  configure_display();
 }
 
 auto REGISTER_SYMBOL_FOR_ADDRESS(uint8_t address) -> std::string {
@@ -103,6 +121,8 @@ void Controller::store_register(bool low, uint8_t value) {
     } else {
       m_background_y_scroll.high = value;
     }
+    // The background line counter is reloaded, the next line displays BYR + 1
+    m_background_y_counter = m_background_y_scroll.byr;
     break;
   case 0b01001:
     if (low) {
@@ -110,6 +130,10 @@ void Controller::store_register(bool low, uint8_t value) {
     } else {
       m_memory_access_width.high = value;
     }
+    if (m_background_attribute_table_fetcher.configure(
+            m_memory_access_width.screen)) {
+      resize_background_attribute_table();
+    }
     break;
   case 0b01010:
     if (low) {
@@ -153,11 +177,34 @@ void Controller::store_register(bool low, uint8_t value) {
       m_block_transfer_control.high = value;
     }
     break;
+  case 0b10000:
+    if (low) {
+      m_block_transfer_source_address.low = value;
+    } else {
+      m_block_transfer_source_address.high = value;
+    }
+    break;
+  case 0b10001:
+    if (low) {
+      m_block_transfer_destination_address.low = value;
+    } else {
+      m_block_transfer_destination_address.high = value;
+    }
+    break;
+  case 0b10010:
+    if (low) {
+      m_block_transfer_length.low = value;
+    } else {
+      m_block_transfer_length.high = value;
+      transfer_vram_vram();
+    }
+    break;
   case 0b10011:
     if (low) {
       m_block_transfer_source_address_vram_satb.low = value;
     } else {
       m_block_transfer_source_address_vram_satb.high = value;
+      m_block_transfer_vram_satb_pending = true;
     }
     break;
   case 0b00000:
@@ -184,14 +231,134 @@ void Controller::store_register(bool low, uint8_t value) {
 }
 
 auto Controller::load_vram(uint16_t address) -> uint16_t {
-  return m_VRAM[address];
+  return m_VRAM[address & (VRAM_LENGTH - 1)];
+}
+
+void Controller::transfer_vram_satb() {
+  m_block_transfer_vram_satb_pending = false;
+  bool changed = m_sprite_attribute_table.transfer(
+      m_VRAM, m_block_transfer_source_address_vram_satb.value);
+  spdlog::get(LOGGER_NAME)
+      ->debug(fmt::format("VRAM-SATB transfer from {:#06x} (changed: {})",
+                          m_block_transfer_source_address_vram_satb.value,
+                          changed));
+
+  m_status.block_transfer_vram_stab_end = 1;
+  if (m_block_transfer_control
+          .vram_satb_transfer_complete_interrupt_request_enable) {
+    m_interrupt_controller->request_interrupt(
+        HuC6280::Interrupt::RequestField::IRQ1);
+  }
+  if (m_sprite_attribute_table.is_over()) {
+    m_status.over = 1;
+    if ((m_control.interrupt_request_enable &
+         InterruptRequestField::OverDetect) != 0) {
+      m_interrupt_controller->request_interrupt(
+          HuC6280::Interrupt::RequestField::IRQ1);
+    }
+  }
+  if (m_sprite_attribute_table.is_collision()) {
+    m_status.collision = 1;
+    if ((m_control.interrupt_request_enable &
+         InterruptRequestField::CollisionDetect) != 0) {
+      m_interrupt_controller->request_interrupt(
+          HuC6280::Interrupt::RequestField::IRQ1);
+    }
+  }
+}
+
+void Controller::transfer_vram_vram() {
+  uint32_t length = m_block_transfer_length.value + 1;
+  uint16_t source = m_block_transfer_source_address.value;
+  uint16_t destination = m_block_transfer_destination_address.value;
+  bool source_decrement = m_block_transfer_control.source_address_inc_dec != 0;
+  bool destination_decrement =
+      m_block_transfer_control.destination_address_inc_dec != 0;
+  spdlog::get(LOGGER_NAME)
+      ->debug(fmt::format("VRAM-VRAM transfer from {:#06x} to {:#06x}, "
+                          "length: {:#06x}",
+                          source, destination, length));
+
+  // The hardware moves one word at a time, when both addresses move in the
+  // same direction and neither range wraps or leaves VRAM, that's equivalent to
+  // a forward or backward bulk copy unless the destination overlaps the words
+  // that are yet to be read
+  uint32_t source_first = source_decrement ? source - (length - 1) : source;
+  uint32_t destination_first =
+      destination_decrement ? destination - (length - 1) : destination;
+  bool in_bounds = source_first + length <= VRAM_LENGTH &&
+                   destination_first + length <= VRAM_LENGTH &&
+                   (!source_decrement || source >= length - 1) &&
+                   (!destination_decrement || destination >= length - 1);
+  auto source_begin = m_VRAM.begin() + source_first;
+  auto destination_begin = m_VRAM.begin() + destination_first;
+  if (in_bounds && !source_decrement && !destination_decrement &&
+      (destination_first < source_first ||
+       destination_first >= source_first + length)) {
+    std::copy(source_begin, source_begin + length, destination_begin);
+    for (uint32_t i = 0; i < length; i++) {
+      mark_vram_dirty(destination_first + i);
+    }
+  } else if (in_bounds && source_decrement && destination_decrement &&
+             (destination_first > source_first ||
+              destination_first + length <= source_first)) {
+    std::copy_backward(source_begin, source_begin + length,
+                       destination_begin + length);
+    for (uint32_t i = 0; i < length; i++) {
+      mark_vram_dirty(destination_first + i);
+    }
+  } else {
+    uint16_t read = source;
+    uint16_t write = destination;
+    for (uint32_t i = 0; i < length; i++) {
+      if (write < VRAM_LENGTH) {
+        m_VRAM[write] = m_VRAM[read & (VRAM_LENGTH - 1)];
+        mark_vram_dirty(write);
+      }
+      read += source_decrement ? -1 : 1;
+      write += destination_decrement ? -1 : 1;
+    }
+  }
+
+  m_block_transfer_source_address.value =
+      source_decrement ? source - length : source + length;
+  m_block_transfer_destination_address.value =
+      destination_decrement ? destination - length : destination + length;
+  m_block_transfer_length.value = 0xFFFF;
+
+  m_status.busy = 1;
+  m_block_transfer_vram_vram_cycles =
+      length * G_VRAM_VRAM_TRANSFER_CYCLES_PER_WORD;
+}
+
+void Controller::complete_vram_vram_transfer() {
+  m_block_transfer_vram_vram_cycles = 0;
+  m_status.busy = 0;
+  m_status.block_transfer_vram_vram_end = 1;
+  if (m_block_transfer_control
+          .vram_vram_transfer_complete_interrupt_request_enable) {
+    m_interrupt_controller->request_interrupt(
+        HuC6280::Interrupt::RequestField::IRQ1);
+  }
 }
 
 void Controller::store_vram() {
-  m_VRAM[m_memory_address_write.value] = m_vram_data_write.value;
+  uint16_t address = m_memory_address_write.value;
+  // Writes beyond the 64KB of VRAM are ignored
+  if (address < VRAM_LENGTH) {
+    m_VRAM[address] = m_vram_data_write.value;
+    mark_vram_dirty(address);
+  }
   m_memory_address_write.value++;
 }
 
+void Controller::mark_vram_dirty(uint16_t address) {
+  if (address < BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_CHARACTERS) {
+    m_dirty_background_attribute_table.set(address);
+  }
+  m_dirty_characters.set(address / BACKGROUND_CHARACTER_GENERATOR_WORDS_LENGTH);
+}
+
 auto Controller::load(uint16_t offset) const -> uint8_t {
   switch (offset & 0b11) {
   case 0b00:
@@ -246,58 +413,264 @@ void Controller::step(uint8_t cycles) {
     m_interrupt_controller->acknowledge_interrupt(
         HuC6280::Interrupt::RequestField::IRQ1);
   }
-  m_cycles += cycles;
-  if (m_cycles >= G_CYCLES_PER_FRAME) {
-    m_cycles = 0;
+  if (m_block_transfer_vram_vram_cycles != 0) {
+    if (m_block_transfer_vram_vram_cycles <= cycles) {
+      complete_vram_vram_transfer();
+    } else {
+      m_block_transfer_vram_vram_cycles -= cycles;
+    }
+  }
+  m_scanline_cycles += cycles;
+  while (m_scanline_cycles >= G_CYCLES_PER_SCANLINE) {
+    m_scanline_cycles -= G_CYCLES_PER_SCANLINE;
+    m_scanline++;
+    if (m_scanline == SCANLINES_PER_FRAME) {
+      m_scanline = 0;
+      if (m_vsync_callback != nullptr) {
+        m_vsync_callback();
+      }
+    }
+    begin_scanline();
+  }
+}
+
+void Controller::configure_display() {
+  // VPR holds the sync pulse width and the lines before the active display,
+  // which the hardware starts counting two lines later
+  m_display_start_scanline =
+      std::min(m_vertical_sync.vertical_sync_pulse_width +
+                   m_vertical_sync.vertical_display_start_position + 2U,
+               SCANLINES_PER_FRAME - 1);
+  m_display_end_scanline =
+      std::min(m_display_start_scanline +
+                   m_vertical_display.vertical_display_width + 1U,
+               SCANLINES_PER_FRAME - 1);
+  configure_line_renderer();
+  m_scanline_run_begin = 0;
+}
+
+void Controller::configure_line_renderer() {
+  m_line_renderer.configure(
+      (m_horizontal_display.horizontal_display_width + 1) *
+          CHARACTER_DOTS_WIDTH,
+      m_display_end_scanline - m_display_start_scanline);
+}
+
+void Controller::begin_scanline() {
+  if (m_scanline == 0) {
+    configure_display();
+  }
+  if (m_scanline >= m_display_start_scanline &&
+      m_scanline < m_display_end_scanline) {
+    latch_scanline_registers(m_scanline - m_display_start_scanline);
+  }
+  if (m_scanline == m_display_end_scanline) {
+    render_scanline_run(m_display_end_scanline - m_display_start_scanline);
+    publish_frame();
     if ((m_control.interrupt_request_enable &
          InterruptRequestField::VerticalBlankingPeriodDetect) != 0) {
       m_interrupt_controller->request_interrupt(
           HuC6280::Interrupt::RequestField::IRQ1);
       m_status.vertical_blanking_period = 1;
     }
-    if (m_vsync_callback != nullptr) {
-      m_vsync_callback();
+    if (m_block_transfer_vram_satb_pending ||
+        m_block_transfer_control.vram_satb_transfer_auto_repeat) {
+      transfer_vram_satb();
     }
   }
+
+  unsigned int raster_counter =
+      m_scanline + G_RASTER_COUNTER_OFFSET - m_display_start_scanline;
+  if (m_scanline + G_RASTER_COUNTER_OFFSET >= m_display_start_scanline &&
+      raster_counter == m_scanning_line_detection.rcr &&
+      (m_control.interrupt_request_enable &
+       InterruptRequestField::ScanningLineDetect) != 0) {
+    m_interrupt_controller->request_interrupt(
+        HuC6280::Interrupt::RequestField::IRQ1);
+    m_status.scanning_line = 1;
+  }
+}
+
+void Controller::latch_scanline_registers(unsigned int line) {
+  if (line == 0) {
+    m_background_y_counter = m_background_y_scroll.byr;
+  } else {
+    m_background_y_counter = (m_background_y_counter + 1) & G_BACKGROUND_Y_MASK;
+  }
+  ScanlineRegisters registers = {.x_scroll = m_background_x_scroll.bxr,
+                                 .y_scroll = m_background_y_counter,
+                                 .control = m_control.value};
+  m_scanline_registers[line] = registers;
+  if (line == 0) {
+    return;
+  }
+  // A run continues as long as the registers only differ by the background
+  // line moving down by one
+  const ScanlineRegisters &previous = m_scanline_registers[line - 1];
+  if (registers.x_scroll != previous.x_scroll ||
+      registers.control != previous.control ||
+      registers.y_scroll !=
+          ((previous.y_scroll + 1) & G_BACKGROUND_Y_MASK)) {
+    render_scanline_run(line);
+  }
+}
+
+void Controller::render_scanline_run(unsigned int end) {
+  if (end <= m_scanline_run_begin) {
+    return;
+  }
+  m_line_renderer.render(m_VRAM, m_background_attribute_table_fetcher,
+                         m_sprite_attribute_table,
+                         m_scanline_registers[m_scanline_run_begin],
+                         m_scanline_run_begin, end - m_scanline_run_begin);
+  m_scanline_run_begin = end;
 }
 
 void Controller::set_vsync_callback(std::function<void()> vsync_callback) {
   m_vsync_callback = std::move(vsync_callback);
 }
 
-auto Controller::get_background_attribute_table_data()
-    -> std::array<float, BACKGROUND_ATTRIBUTE_TABLE_DATA_LENGTH> {
-  std::array<float, BACKGROUND_ATTRIBUTE_TABLE_DATA_LENGTH> background_data =
-      {};
-  for (unsigned int y = 0; y < BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_ROWS; y++) {
-    for (unsigned int x = 0;
-         x < BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW; x++) {
-      unsigned int address =
-          x + y * BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW;
-      uint16_t data = load_vram(address);
-      auto character = Character(data);
-      uint16_t character_data_address = character.code;
-      character_data_address <<= 4;
-      auto character_data =
-          get_character_data(character_data_address, character.cg_color);
-      for (unsigned int y_char = 0; y_char < CHARACTER_DOTS_HEIGHT; y_char++) {
-        for (unsigned int x_char = 0; x_char < CHARACTER_DOTS_WIDTH; x_char++) {
-          unsigned int source_index =
-              (x_char + y_char * CHARACTER_DOTS_HEIGHT) * 3;
-          unsigned int destination_index =
-              (x_char + (x * CHARACTER_DOTS_WIDTH)) * 3 +
-              (y_char + (y * CHARACTER_DOTS_HEIGHT)) * CHARACTER_DOTS_HEIGHT *
-                  BACKGROUND_ATTRIBUTE_TABLE_NUMBER_OF_CHARACTERS_PER_ROW * 3;
-          background_data[destination_index] = character_data[source_index];
-          background_data[destination_index + 1] =
-              character_data[source_index + 1];
-          background_data[destination_index + 2] =
-              character_data[source_index + 2];
+void Controller::attach_frame_sink(std::shared_ptr<FrameSink> frame_sink) {
+  m_frame_sinks.push_back(std::move(frame_sink));
+}
+
+void Controller::publish_frame() {
+  m_frame_sequence++;
+  if (m_frame_sinks.empty()) {
+    return;
+  }
+  const auto &frame_buffer = m_line_renderer.get_frame_buffer();
+  unsigned int width = m_line_renderer.get_width();
+  unsigned int height = m_line_renderer.get_height();
+  for (auto &frame_sink : m_frame_sinks) {
+    Frame &frame = frame_sink->back();
+    frame.sequence = m_frame_sequence;
+    frame.width = width;
+    frame.height = height;
+    std::copy(frame_buffer.begin(), frame_buffer.begin() + width * height,
+              frame.dots.begin());
+    m_video_color_encoder_controller->copy_color_table(frame.color_table);
+    frame_sink->publish();
+  }
+}
+
+void Controller::resize_background_attribute_table() {
+  m_background_attribute_table_data.resize(
+      static_cast<size_t>(m_background_attribute_table_fetcher.get_columns()) *
+      m_background_attribute_table_fetcher.get_rows() * CHARACTER_DATA_LENGTH);
+  m_dirty_background_attribute_table.set();
+}
+
+void Controller::render_background_attribute_table_character(unsigned int x,
+                                                             unsigned int y) {
+  auto character = m_background_attribute_table_fetcher.fetch(m_VRAM, x, y);
+  uint16_t character_data_address = character.code;
+  character_data_address <<= 4;
+  auto character_data =
+      get_character_data(character_data_address, character.cg_color);
+  unsigned int row_length =
+      m_background_attribute_table_fetcher.get_columns() *
+      CHARACTER_DOTS_WIDTH;
+  for (unsigned int y_char = 0; y_char < CHARACTER_DOTS_HEIGHT; y_char++) {
+    for (unsigned int x_char = 0; x_char < CHARACTER_DOTS_WIDTH; x_char++) {
+      unsigned int source_index = (x_char + y_char * CHARACTER_DOTS_HEIGHT) * 3;
+      unsigned int destination_index =
+          (x_char + (x * CHARACTER_DOTS_WIDTH)) * 3 +
+          (y_char + (y * CHARACTER_DOTS_HEIGHT)) * row_length * 3;
+      m_background_attribute_table_data[destination_index] =
+          character_data[source_index];
+      m_background_attribute_table_data[destination_index + 1] =
+          character_data[source_index + 1];
+      m_background_attribute_table_data[destination_index + 2] =
+          character_data[source_index + 2];
+    }
+  }
+}
+
+auto Controller::get_background_attribute_table_data(
+    std::vector<DirtyRectangle> &dirty_rectangles)
+    -> const std::vector<float> & {
+  dirty_rectangles.clear();
+
+  uint32_t color_table_generation =
+      m_video_color_encoder_controller->get_color_table_generation();
+  if (color_table_generation !=
+      m_background_attribute_table_color_table_generation) {
+    m_background_attribute_table_color_table_generation =
+        color_table_generation;
+    m_dirty_background_attribute_table.set();
+  }
+  unsigned int columns = m_background_attribute_table_fetcher.get_columns();
+  unsigned int rows = m_background_attribute_table_fetcher.get_rows();
+  if (m_dirty_characters.any() && !m_dirty_background_attribute_table.all()) {
+    for (unsigned int address = 0; address < columns * rows; address++) {
+      auto character = Character(load_vram(address));
+      if (m_dirty_characters.test(character.code %
+                                  VRAM_NUMBER_OF_CHARACTERS)) {
+        m_dirty_background_attribute_table.set(address);
+      }
+    }
+  }
+  m_dirty_characters.reset();
+  if (m_dirty_background_attribute_table.none()) {
+    return m_background_attribute_table_data;
+  }
+
+  // Dirty characters are coalesced into horizontal runs, and runs that span
+  // the same columns on consecutive rows are merged into a single rectangle
+  for (unsigned int y = 0; y < rows; y++) {
+    unsigned int row_address =
+        m_background_attribute_table_fetcher.get_address(0, y);
+    unsigned int x = 0;
+    while (x < columns) {
+      if (!m_dirty_background_attribute_table.test(row_address + x)) {
+        x++;
+        continue;
+      }
+      unsigned int run_begin = x;
+      while (x < columns &&
+             m_dirty_background_attribute_table.test(row_address + x)) {
+        render_background_attribute_table_character(x, y);
+        x++;
+      }
+      DirtyRectangle run = {.x = run_begin * CHARACTER_DOTS_WIDTH,
+                            .y = y * CHARACTER_DOTS_HEIGHT,
+                            .width = (x - run_begin) * CHARACTER_DOTS_WIDTH,
+                            .height = CHARACTER_DOTS_HEIGHT};
+      bool merged = false;
+      for (auto &rectangle : dirty_rectangles) {
+        if (rectangle.x == run.x && rectangle.width == run.width &&
+            rectangle.y + rectangle.height == run.y) {
+          rectangle.height += run.height;
+          merged = true;
+          break;
         }
       }
+      if (!merged) {
+        dirty_rectangles.push_back(run);
+      }
     }
   }
-  return background_data;
+  m_dirty_background_attribute_table.reset();
+  return m_background_attribute_table_data;
+}
+
+auto Controller::get_background_attribute_table_dimensions() const
+    -> std::pair<unsigned int, unsigned int> {
+  return {m_background_attribute_table_fetcher.get_columns() *
+              CHARACTER_DOTS_WIDTH,
+          m_background_attribute_table_fetcher.get_rows() *
+              CHARACTER_DOTS_HEIGHT};
+}
+
+auto Controller::get_frame_buffer() const
+    -> const std::array<uint16_t, FRAME_BUFFER_MAX_DOTS> & {
+  return m_line_renderer.get_frame_buffer();
+}
+
+auto Controller::get_frame_buffer_dimensions() const
+    -> std::pair<unsigned int, unsigned int> {
+  return {m_line_renderer.get_width(), m_line_renderer.get_height()};
 }
 
 auto Controller::get_character_data(uint16_t address, uint16_t color_area)
@@ -378,3 +751,87 @@ auto Controller::get_character_generator_data()
   }
   return character_generator_data;
 }
+
+void Controller::save_state(StateWriter &writer) const {
+  writer.begin_section(G_STATE_TAG);
+  writer.write(m_VRAM);
+  writer.write(m_scanline_cycles);
+  writer.write(m_scanline);
+  writer.write(m_display_start_scanline);
+  writer.write(m_display_end_scanline);
+  writer.write(m_background_y_counter);
+  writer.write(m_address);
+  writer.write(m_status);
+  writer.write(m_control);
+  writer.write(m_scanning_line_detection);
+  writer.write(m_background_x_scroll);
+  writer.write(m_background_y_scroll);
+  writer.write(m_memory_access_width);
+  writer.write(m_horizontal_sync);
+  writer.write(m_horizontal_display);
+  writer.write(m_vertical_sync);
+  writer.write(m_vertical_display);
+  writer.write(m_vertical_display_end_position);
+  writer.write(m_block_transfer_control);
+  writer.write(m_block_transfer_source_address);
+  writer.write(m_block_transfer_destination_address);
+  writer.write(m_block_transfer_length);
+  writer.write(m_block_transfer_vram_vram_cycles);
+  writer.write(m_block_transfer_source_address_vram_satb);
+  writer.write(m_block_transfer_vram_satb_pending);
+  writer.write(m_memory_address_write);
+  writer.write(m_vram_data_write);
+  writer.write(m_state->is_dirty());
+  writer.write(m_scanline_registers);
+  writer.write(m_scanline_run_begin);
+  writer.end_section();
+  m_sprite_attribute_table.save_state(writer);
+}
+
+void Controller::load_state(StateReader &reader) {
+  reader.open_section(G_STATE_TAG);
+  reader.read(m_VRAM);
+  reader.read(m_scanline_cycles);
+  reader.read(m_scanline);
+  reader.read(m_display_start_scanline);
+  reader.read(m_display_end_scanline);
+  reader.read(m_background_y_counter);
+  reader.read(m_address);
+  reader.read(m_status);
+  reader.read(m_control);
+  reader.read(m_scanning_line_detection);
+  reader.read(m_background_x_scroll);
+  reader.read(m_background_y_scroll);
+  reader.read(m_memory_access_width);
+  reader.read(m_horizontal_sync);
+  reader.read(m_horizontal_display);
+  reader.read(m_vertical_sync);
+  reader.read(m_vertical_display);
+  reader.read(m_vertical_display_end_position);
+  reader.read(m_block_transfer_control);
+  reader.read(m_block_transfer_source_address);
+  reader.read(m_block_transfer_destination_address);
+  reader.read(m_block_transfer_length);
+  reader.read(m_block_transfer_vram_vram_cycles);
+  reader.read(m_block_transfer_source_address_vram_satb);
+  reader.read(m_block_transfer_vram_satb_pending);
+  reader.read(m_memory_address_write);
+  reader.read(m_vram_data_write);
+  bool dirty = false;
+  reader.read(dirty);
+  if (dirty) {
+    m_state->mark_dirty();
+  } else {
+    m_state->clear_dirty();
+  }
+  reader.read(m_scanline_registers);
+  reader.read(m_scanline_run_begin);
+  m_sprite_attribute_table.load_state(reader);
+
+  // The frame buffer is not part of the state, only the lines rendered after
+  // loading are valid until the next frame starts
+  m_background_attribute_table_fetcher.configure(
+      m_memory_access_width.screen);
+  configure_line_renderer();
+  resize_background_attribute_table();
+}
@@ -1,15 +1,25 @@
 #ifndef SAKURA_VIDEO_DISPLAY_CONTROLLER_HPP
 #define SAKURA_VIDEO_DISPLAY_CONTROLLER_HPP
 
+#include "BackgroundAttributeTable.hpp"
+#include "LineRenderer.hpp"
+#include "SpriteAttributeTable.hpp"
 #include <array>
+#include <bitset>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <sakura/Constants.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Sakura {
 struct VDCConfig;
+struct DirtyRectangle;
+class FrameSink;
+class StateReader;
+class StateWriter;
 
 namespace HuC6280::Interrupt {
 class Controller;
@@ -22,6 +32,10 @@ class Controller;
 namespace HuC6270 {
 static const std::string LOGGER_NAME = "--huc6270--";
 
+constexpr unsigned int VRAM_NUMBER_OF_CHARACTERS =
+    VRAM_LENGTH / BACKGROUND_CHARACTER_GENERATOR_WORDS_LENGTH;
+constexpr unsigned int SCANLINES_PER_FRAME = 263;
+
 union Address {
   struct {
     uint8_t address : 5;
@@ -228,6 +242,36 @@ union BlockTransferControl {
   BlockTransferControl() : value() {}
 };
 
+union BlockTransferSourceAddress {
+  struct {
+    uint16_t low : 8;
+    uint16_t high : 8;
+  };
+  uint16_t value;
+
+  BlockTransferSourceAddress() : value() {}
+};
+
+union BlockTransferDestinationAddress {
+  struct {
+    uint16_t low : 8;
+    uint16_t high : 8;
+  };
+  uint16_t value;
+
+  BlockTransferDestinationAddress() : value() {}
+};
+
+union BlockTransferLength {
+  struct {
+    uint16_t low : 8;
+    uint16_t high : 8;
+  };
+  uint16_t value;
+
+  BlockTransferLength() : value() {}
+};
+
 union BlockTransferSourceAddressVRAMSATB {
   struct {
     uint16_t low : 8;
@@ -271,21 +315,15 @@ public:
   void clear_dirty() { m_dirty = false; };
 };
 
-union Character {
-  struct {
-    uint16_t code : 12;
-    uint16_t cg_color : 4;
-  };
-  uint16_t value;
-
-  Character(uint16_t data) : value(data) {}
-};
-
 class Controller {
 private:
-  std::array<uint16_t, 0x8000> m_VRAM;
+  std::array<uint16_t, VRAM_LENGTH> m_VRAM;
 
-  uint32_t m_cycles;
+  uint32_t m_scanline_cycles;
+  unsigned int m_scanline;
+  unsigned int m_display_start_scanline;
+  unsigned int m_display_end_scanline;
+  uint16_t m_background_y_counter;
 
   Address m_address;
   Status m_status;
@@ -300,7 +338,12 @@ private:
   VerticalDisplay m_vertical_display;
   VerticalDisplayEndPosition m_vertical_display_end_position;
   BlockTransferControl m_block_transfer_control;
+  BlockTransferSourceAddress m_block_transfer_source_address;
+  BlockTransferDestinationAddress m_block_transfer_destination_address;
+  BlockTransferLength m_block_transfer_length;
+  uint32_t m_block_transfer_vram_vram_cycles;
   BlockTransferSourceAddressVRAMSATB m_block_transfer_source_address_vram_satb;
+  bool m_block_transfer_vram_satb_pending;
   MemoryAddressWrite m_memory_address_write;
   VRAMDataWrite m_vram_data_write;
 
@@ -308,11 +351,43 @@ private:
   std::unique_ptr<HuC6260::Controller> &m_video_color_encoder_controller;
   std::unique_ptr<ControllerState> m_state;
 
+  SpriteAttributeTable m_sprite_attribute_table;
+  BackgroundAttributeTableFetcher m_background_attribute_table_fetcher;
+
+  // Registers latched for every displayed line, consecutive lines that share
+  // the same state are handed to the renderer as a single run
+  std::array<ScanlineRegisters, SCANLINES_PER_FRAME> m_scanline_registers;
+  unsigned int m_scanline_run_begin;
+  LineRenderer m_line_renderer;
+
+  // Sized for the virtual screen selected by MWR, one row of dots after the
+  // other
+  std::vector<float> m_background_attribute_table_data;
+  std::bitset<BACKGROUND_ATTRIBUTE_TABLE_MAX_NUMBER_OF_CHARACTERS>
+      m_dirty_background_attribute_table;
+  std::bitset<VRAM_NUMBER_OF_CHARACTERS> m_dirty_characters;
+  uint32_t m_background_attribute_table_color_table_generation;
+
   std::function<void()> m_vsync_callback;
+  std::vector<std::shared_ptr<FrameSink>> m_frame_sinks;
+  uint64_t m_frame_sequence;
 
   auto load_vram(uint16_t address) -> uint16_t;
   void store_vram();
+  void mark_vram_dirty(uint16_t address);
+  void resize_background_attribute_table();
+  void render_background_attribute_table_character(unsigned int x,
+                                                   unsigned int y);
   void store_register(bool low, uint8_t value);
+  void transfer_vram_satb();
+  void transfer_vram_vram();
+  void complete_vram_vram_transfer();
+  void configure_display();
+  void configure_line_renderer();
+  void begin_scanline();
+  void latch_scanline_registers(unsigned int line);
+  void render_scanline_run(unsigned int end);
+  void publish_frame();
   auto get_character_data(uint16_t address, uint16_t color_area)
       -> std::array<float, CHARACTER_DATA_LENGTH>;
 
@@ -326,10 +401,24 @@ public:
   [[nodiscard]] auto load(uint16_t offset) const -> uint8_t;
   void store(uint16_t offset, uint8_t value);
   void step(uint8_t cycles);
+  void save_state(StateWriter &writer) const;
+  void load_state(StateReader &reader);
 
   void set_vsync_callback(std::function<void()> vsync_callback);
-  auto get_background_attribute_table_data()
-      -> std::array<float, BACKGROUND_ATTRIBUTE_TABLE_DATA_LENGTH>;
+  void attach_frame_sink(std::shared_ptr<FrameSink> frame_sink);
+  auto get_background_attribute_table_data(
+      std::vector<DirtyRectangle> &dirty_rectangles)
+      -> const std::vector<float> &;
+  [[nodiscard]] auto get_background_attribute_table_dimensions() const
+      -> std::pair<unsigned int, unsigned int>;
+  [[nodiscard]] auto get_vram() const
+      -> const std::array<uint16_t, VRAM_LENGTH> & {
+    return m_VRAM;
+  }
+  [[nodiscard]] auto get_frame_buffer() const
+      -> const std::array<uint16_t, FRAME_BUFFER_MAX_DOTS> &;
+  [[nodiscard]] auto get_frame_buffer_dimensions() const
+      -> std::pair<unsigned int, unsigned int>;
   auto get_character_generator_data()
       -> std::array<float, CHARACTER_GENERATOR_DATA_LENGTH>;
 };
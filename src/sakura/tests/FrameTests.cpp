@@ -0,0 +1,158 @@
+#include "TestEmulator.hpp"
+#include <Workloads.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <common/Hash.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <fmt/core.h>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <sakura/Emulator.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Sakura;
+
+// Frames a workload runs for when it is added to the golden hashes
+const uint64_t G_DEFAULT_GOLDEN_FRAMES = 60;
+
+struct FrameHashes {
+  uint64_t frame_buffer;
+  uint64_t background_attribute_table;
+  uint64_t character_generator;
+  uint64_t color_table;
+};
+
+// Colors are quantized the same way frame buffer dumps are, so the hashes
+// don't depend on how the float math is compiled
+auto HASH_COLORS(const float *data, size_t length) -> uint64_t {
+  std::vector<uint8_t> bytes(length);
+  for (size_t i = 0; i < length; i++) {
+    bytes[i] = static_cast<uint8_t>(data[i] * 255.0F);
+  }
+  return Common::Hash::xxh64(bytes.data(), bytes.size());
+}
+
+auto RUN_GOLDEN_FRAMES(Emulator &emulator, uint64_t frames) -> FrameHashes {
+  emulator.emulate_frames(frames);
+  std::unique_ptr<RendererInfo> &renderer_info = emulator.get_renderer_info();
+  auto [width, height] = renderer_info->get_frame_buffer_dimensions();
+  std::vector<DirtyRectangle> dirty_rectangles;
+  const auto &background_attribute_table =
+      renderer_info->get_background_attribute_table_data(dirty_rectangles);
+  auto frame_buffer = renderer_info->get_frame_buffer_data();
+  auto character_generator = renderer_info->get_character_generator_data();
+  return {.frame_buffer = HASH_COLORS(frame_buffer.data(),
+                                      static_cast<size_t>(width) * height * 3),
+          .background_attribute_table =
+              HASH_COLORS(background_attribute_table.data(),
+                          background_attribute_table.size()),
+          .character_generator = HASH_COLORS(character_generator.data(),
+                                             character_generator.size()),
+          .color_table = emulator.get_state_digest().color_table_hash};
+}
+
+auto FORMAT_HASH(uint64_t hash) -> std::string {
+  return fmt::format("{:016x}", hash);
+}
+
+// SAKURA_UPDATE_GOLDEN_FRAMES rewrites the golden hashes instead of checking
+// them, after a change that is meant to alter the output
+auto IS_UPDATING_GOLDEN_FRAMES() -> bool {
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  return std::getenv("SAKURA_UPDATE_GOLDEN_FRAMES") != nullptr;
+}
+
+TEST_CASE("Workloads render the golden frames", "[golden_frames]") {
+  std::filesystem::path path = SAKURA_GOLDEN_FRAMES_PATH;
+  nlohmann::json golden = nlohmann::json::object();
+  std::ifstream file = std::ifstream(path);
+  if (file.is_open()) {
+    file >> golden;
+  }
+
+  std::vector<Workloads::Workload> workloads = Workloads::GENERATE_WORKLOADS();
+  std::vector<uint64_t> frames;
+  // Loggers are registered globally, emulators are only initialized on
+  // this thread
+  std::vector<std::unique_ptr<Emulator>> emulators;
+  for (const auto &workload : workloads) {
+    frames.push_back(
+        golden.value(workload.name, nlohmann::json::object())
+            .value("frames", G_DEFAULT_GOLDEN_FRAMES));
+    emulators.push_back(Tests::MAKE_TEST_EMULATOR(workload.rom));
+  }
+
+  // Workloads are handed out to one worker per core
+  std::vector<FrameHashes> hashes(workloads.size());
+  std::atomic<size_t> next(0);
+  unsigned int worker_count = std::min<unsigned int>(
+      std::max(std::thread::hardware_concurrency(), 1U), workloads.size());
+  std::vector<std::thread> workers;
+  for (unsigned int i = 0; i < worker_count; i++) {
+    workers.emplace_back([&] {
+      for (size_t index = next++; index < workloads.size(); index = next++) {
+        hashes[index] = RUN_GOLDEN_FRAMES(*emulators[index], frames[index]);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // A frame shared by two workloads is most likely one where nothing was
+  // drawn, which can't catch a rendering regression
+  std::map<uint64_t, std::string> frame_buffers;
+  for (size_t i = 0; i < workloads.size(); i++) {
+    auto [other, inserted] =
+        frame_buffers.emplace(hashes[i].frame_buffer, workloads[i].name);
+    if (!inserted) {
+      FAIL_CHECK(fmt::format("{} renders the same frame buffer as {}",
+                             workloads[i].name, other->second));
+    }
+  }
+
+  if (IS_UPDATING_GOLDEN_FRAMES()) {
+    nlohmann::json updated = nlohmann::json::object();
+    for (size_t i = 0; i < workloads.size(); i++) {
+      updated[workloads[i].name] = {
+          {"frames", frames[i]},
+          {"frame_buffer", FORMAT_HASH(hashes[i].frame_buffer)},
+          {"background_attribute_table",
+           FORMAT_HASH(hashes[i].background_attribute_table)},
+          {"character_generator", FORMAT_HASH(hashes[i].character_generator)},
+          {"color_table", FORMAT_HASH(hashes[i].color_table)}};
+    }
+    std::ofstream output = std::ofstream(path);
+    output << updated.dump(2) << std::endl;
+    WARN(fmt::format("Golden frames written to {}", path.string()));
+    return;
+  }
+
+  for (size_t i = 0; i < workloads.size(); i++) {
+    const std::string &name = workloads[i].name;
+    INFO(fmt::format("{} is missing from {}, run the tests with "
+                     "SAKURA_UPDATE_GOLDEN_FRAMES set",
+                     name, path.string()));
+    REQUIRE(golden.contains(name));
+    const std::array<std::pair<const char *, uint64_t>, 4> fields = {
+        {{"frame_buffer", hashes[i].frame_buffer},
+         {"background_attribute_table",
+          hashes[i].background_attribute_table},
+         {"character_generator", hashes[i].character_generator},
+         {"color_table", hashes[i].color_table}}};
+    for (const auto &[field, hash] : fields) {
+      std::string expected = golden[name].value(field, "");
+      if (expected != FORMAT_HASH(hash)) {
+        FAIL_CHECK(fmt::format("{}: {} is {}, expected {}", name, field,
+                               FORMAT_HASH(hash), expected));
+      }
+    }
+  }
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sakura/InputMovie.hpp>
+#include <vector>
+
+using namespace Sakura;
+
+auto INPUT_MOVIE_TEST_PATH() -> std::filesystem::path {
+  return std::filesystem::temp_directory_path() /
+         "sakura_input_movie_test.skmv";
+}
+
+auto READ_INPUT_MOVIE_FILE(const std::filesystem::path &path)
+    -> std::vector<uint8_t> {
+  std::ifstream file = std::ifstream(path, std::ios::in | std::ios::binary);
+  return {std::istreambuf_iterator<char>(file),
+          std::istreambuf_iterator<char>()};
+}
+
+void WRITE_INPUT_MOVIE_FILE(const std::filesystem::path &path,
+                            const std::vector<uint8_t> &data) {
+  std::ofstream file = std::ofstream(path, std::ios::out | std::ios::binary);
+  file.write(reinterpret_cast<const char *>(data.data()), data.size());
+}
+
+auto MAKE_TEST_INPUT_MOVIE() -> InputMovie {
+  InputMovie movie = InputMovie();
+  for (uint64_t frame = 0; frame < 100; frame++) {
+    movie.record(frame, frame >= 10 && frame < 20 ? 0x01 : frame / 50 * 0x80);
+  }
+  return movie;
+}
+
+TEST_CASE("Input movies only keep changes", "[input_movie]") {
+  InputMovie movie = MAKE_TEST_INPUT_MOVIE();
+  REQUIRE(movie.get_events().size() == 3);
+  CHECK(movie.get_length() == 50);
+  CHECK(movie.get_buttons(0) == 0x00);
+  CHECK(movie.get_buttons(10) == 0x01);
+  CHECK(movie.get_buttons(19) == 0x01);
+  CHECK(movie.get_buttons(20) == 0x00);
+  CHECK(movie.get_buttons(1000) == 0x80);
+
+  // Recording over an earlier frame drops what came after it
+  movie.record(15, 0x02);
+  REQUIRE(movie.get_events().size() == 2);
+  CHECK(movie.get_length() == 15);
+  CHECK(movie.get_buttons(12) == 0x01);
+  CHECK(movie.get_buttons(1000) == 0x02);
+}
+
+TEST_CASE("Input movies round trip through files", "[input_movie]") {
+  std::filesystem::path path = INPUT_MOVIE_TEST_PATH();
+  InputMovie movie = MAKE_TEST_INPUT_MOVIE();
+  REQUIRE(movie.save(path));
+
+  // Magic, version, event count and then a frame and buttons per event with
+  // no padding, little-endian
+  std::vector<uint8_t> data = READ_INPUT_MOVIE_FILE(path);
+  const std::vector<uint8_t> expected = {
+      'S',  'K',  'M',  'V',  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+      0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00,
+      0x32, 0x00, 0x00, 0x00, 0x80};
+  CHECK(data == expected);
+
+  InputMovie loaded = InputMovie();
+  REQUIRE(loaded.load(path));
+  REQUIRE(loaded.get_events().size() == movie.get_events().size());
+  for (size_t i = 0; i < movie.get_events().size(); i++) {
+    CHECK(loaded.get_events()[i].frame == movie.get_events()[i].frame);
+    CHECK(loaded.get_events()[i].buttons == movie.get_events()[i].buttons);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Input movies reject other files", "[input_movie]") {
+  std::filesystem::path path = INPUT_MOVIE_TEST_PATH();
+  REQUIRE(MAKE_TEST_INPUT_MOVIE().save(path));
+  std::vector<uint8_t> data = READ_INPUT_MOVIE_FILE(path);
+
+  SECTION("Missing") { std::filesystem::remove(path); }
+  SECTION("Magic") {
+    data[0] = 'X';
+    WRITE_INPUT_MOVIE_FILE(path, data);
+  }
+  SECTION("Version") {
+    data[4] = 0x02;
+    WRITE_INPUT_MOVIE_FILE(path, data);
+  }
+  SECTION("Truncated") {
+    data.pop_back();
+    WRITE_INPUT_MOVIE_FILE(path, data);
+  }
+  SECTION("Frames out of order") {
+    // Second event at frame 0x0A, before the first
+    data[17] = 0x0A;
+    data[12] = 0x14;
+    WRITE_INPUT_MOVIE_FILE(path, data);
+  }
+
+  // A movie that fails to load is left as it was
+  InputMovie movie = InputMovie();
+  movie.record(5, 0x04);
+  CHECK_FALSE(movie.load(path));
+  REQUIRE(movie.get_events().size() == 1);
+  CHECK(movie.get_buttons(5) == 0x04);
+  std::filesystem::remove(path);
+}
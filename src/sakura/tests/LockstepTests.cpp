@@ -0,0 +1,91 @@
+#include "TestEmulator.hpp"
+#include <Workloads.hpp>
+#include <catch2/catch.hpp>
+#include <memory>
+#include <sakura/Emulator.hpp>
+#include <sakura/Lockstep.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Sakura;
+
+const uint64_t G_LOCKSTEP_TEST_FRAMES = 2;
+const uint64_t G_LOCKSTEP_TEST_STEPS = 100;
+const uint64_t G_LOCKSTEP_TEST_BLOCK_CYCLES = 1024;
+// Last byte of RAM, past the zero page and the stack the workload uses
+const size_t G_LOCKSTEP_TEST_RAM_OFFSET = 0x1FFF;
+
+struct LockstepTestEmulators {
+  std::unique_ptr<Emulator> reference;
+  std::unique_ptr<Emulator> candidate;
+};
+
+// Both load the same snapshot, the candidate's with one byte of RAM changed
+// when diverged is set
+auto MAKE_LOCKSTEP_TEST_EMULATORS(bool diverged) -> LockstepTestEmulators {
+  std::vector<uint8_t> rom = Workloads::GENERATE_WORKLOADS().front().rom;
+  LockstepTestEmulators emulators = {
+      .reference = Tests::MAKE_TEST_EMULATOR(rom),
+      .candidate = Tests::MAKE_TEST_EMULATOR(rom)};
+  emulators.reference->emulate_frames(G_LOCKSTEP_TEST_FRAMES);
+  std::vector<uint8_t> state;
+  emulators.reference->save_state(state);
+  if (diverged) {
+    state[Tests::FIND_STATE_RAM(state) + G_LOCKSTEP_TEST_RAM_OFFSET] ^= 0xFF;
+  }
+  REQUIRE(emulators.candidate->load_state(state));
+  return emulators;
+}
+
+// The line of a field in a report, starting with '*' when it differs. Lines
+// are a marker, a space and the name padded to 12 columns
+auto FIND_LOCKSTEP_FIELD(const std::string &report, const std::string &name)
+    -> std::string {
+  std::istringstream lines(report);
+  std::string line;
+  while (std::getline(lines, line)) {
+    if (line.size() > 2 + name.size() &&
+        line.compare(2, name.size() + 1, name + " ") == 0) {
+      return line;
+    }
+  }
+  return "";
+}
+
+TEST_CASE("Lockstep keeps going while the emulators agree", "[lockstep]") {
+  auto [reference, candidate] = MAKE_LOCKSTEP_TEST_EMULATORS(false);
+  Lockstep lockstep(*reference, *candidate, LockstepGranularity::Instruction,
+                    G_LOCKSTEP_TEST_BLOCK_CYCLES);
+  for (uint64_t i = 0; i < G_LOCKSTEP_TEST_STEPS; i++) {
+    REQUIRE(lockstep.step());
+  }
+  CHECK(lockstep.get_steps() == G_LOCKSTEP_TEST_STEPS);
+  CHECK(lockstep.get_report().empty());
+}
+
+TEST_CASE("Lockstep reports where the emulators diverge", "[lockstep]") {
+  auto [reference, candidate] = MAKE_LOCKSTEP_TEST_EMULATORS(true);
+  LockstepGranularity granularity = LockstepGranularity::Instruction;
+  SECTION("Instruction") {}
+  SECTION("Block") { granularity = LockstepGranularity::Block; }
+  SECTION("Frame") { granularity = LockstepGranularity::Frame; }
+  Lockstep lockstep(*reference, *candidate, granularity,
+                    G_LOCKSTEP_TEST_BLOCK_CYCLES);
+
+  // The changed byte is never touched, so the first step already differs
+  CHECK_FALSE(lockstep.step());
+  CHECK(lockstep.get_steps() == 1);
+  const std::string &report = lockstep.get_report();
+  INFO(report);
+  CHECK(FIND_LOCKSTEP_FIELD(report, "ram").rfind("* ram", 0) == 0);
+  for (const auto &name : {"instructions", "cycles", "pc", "a", "x", "y", "s",
+                           "p", "vram", "ctram"}) {
+    CHECK(FIND_LOCKSTEP_FIELD(report, name).rfind("  ", 0) == 0);
+  }
+  CHECK(report.find("next") != std::string::npos);
+
+  // A diverged lockstep stays stopped
+  CHECK_FALSE(lockstep.step());
+  CHECK(lockstep.get_steps() == 1);
+}
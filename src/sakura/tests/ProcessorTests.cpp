@@ -0,0 +1,264 @@
+#define CATCH_CONFIG_MAIN
+#include "Instructions.hpp"
+#include "Machine.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <cstdlib>
+#include <filesystem>
+#include <fmt/core.h>
+#include <fstream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <sakura/Emulator.hpp>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Sakura;
+
+const uint8_t G_TXS_OPCODE = 0x9A;
+const uint8_t G_MEMORY_OPERATION_FLAG = 0x20;
+const uint8_t G_DECIMAL_FLAG = 0x08;
+// I/O, RAM and the first banks of a HuCard, used when a vector doesn't set
+// the mapping registers
+const std::array<uint8_t, 8> G_DEFAULT_MAPPING = {0xFF, 0xF8, 0x01, 0x02,
+                                                  0x03, 0x04, 0x05, 0x00};
+// Per opcode and engine, the rest of the failures are only counted
+const size_t G_MAX_REPORTED_FAILURES = 4;
+
+// Runs the instruction at the program counter and returns its cycles
+using Engine = uint8_t (*)(std::unique_ptr<HuC6280::Processor> &processor);
+
+auto RUN_INTERPRETER(std::unique_ptr<HuC6280::Processor> &processor)
+    -> uint8_t {
+  uint8_t opcode = processor->fetch_instruction();
+  return HuC6280::INTERPRETER_TABLE[opcode](processor, opcode);
+}
+
+// Every engine runs every vector, alternative engines are added here
+const std::array<std::pair<const char *, Engine>, 1> G_ENGINES = {
+    {{"interpreter", RUN_INTERPRETER}}};
+
+struct CPUState {
+  HuC6280::Registers registers;
+  std::array<uint8_t, 8> mapping;
+  std::vector<std::pair<uint16_t, uint8_t>> ram;
+};
+
+struct TestVector {
+  std::string name;
+  CPUState initial;
+  CPUState final;
+  unsigned int cycles;
+};
+
+struct OpcodeResult {
+  bool found;
+  size_t passed;
+  size_t failed;
+  // Vectors the interpreter can't run, see IS_SUPPORTED
+  size_t skipped;
+  std::vector<std::string> failures;
+};
+
+auto PARSE_STATE(const nlohmann::json &json) -> CPUState {
+  CPUState state = {};
+  state.registers.program_counter.value = json.at("pc").get<uint16_t>();
+  state.registers.stack_pointer = json.at("s").get<uint8_t>();
+  state.registers.accumulator = json.at("a").get<uint8_t>();
+  state.registers.x = json.at("x").get<uint8_t>();
+  state.registers.y = json.at("y").get<uint8_t>();
+  state.registers.status.value = json.at("p").get<uint8_t>();
+  state.mapping = json.value("mpr", G_DEFAULT_MAPPING);
+  state.ram =
+      json.at("ram").get<std::vector<std::pair<uint16_t, uint8_t>>>();
+  return state;
+}
+
+// One file per opcode holding an array of vectors. Cycles are either a
+// count or, as in other single step suites, a list with one entry per cycle
+auto LOAD_VECTORS(const std::filesystem::path &path)
+    -> std::vector<TestVector> {
+  std::ifstream file = std::ifstream(path);
+  nlohmann::json json = nlohmann::json::parse(file);
+  std::vector<TestVector> vectors;
+  vectors.reserve(json.size());
+  for (const auto &entry : json) {
+    const nlohmann::json &cycles = entry.at("cycles");
+    vectors.push_back(
+        {.name = entry.at("name").get<std::string>(),
+         .initial = PARSE_STATE(entry.at("initial")),
+         .final = PARSE_STATE(entry.at("final")),
+         .cycles = static_cast<unsigned int>(
+             cycles.is_array() ? cycles.size() : cycles.get<unsigned int>())});
+  }
+  return vectors;
+}
+
+// The interpreter stops the process on the T and D flag variants it doesn't
+// implement, those vectors are left out
+auto IS_SUPPORTED(const TestVector &vector) -> bool {
+  return (vector.initial.registers.status.value &
+          (G_MEMORY_OPERATION_FLAG | G_DECIMAL_FLAG)) == 0;
+}
+
+void SET_MAPPING(Machine &machine, const std::array<uint8_t, 8> &mapping) {
+  for (uint8_t i = 0; i < mapping.size(); i++) {
+    machine.mapping_controller->set_mapping_register(i, mapping[i]);
+  }
+}
+
+// Differences with the final state, empty when the vector passes
+auto RUN_VECTOR(Machine &machine, Engine engine, const TestVector &vector)
+    -> std::string {
+  auto &mapping_controller = machine.mapping_controller;
+  SET_MAPPING(machine, vector.initial.mapping);
+  for (const auto &[address, value] : vector.initial.ram) {
+    mapping_controller->poke(address, value);
+  }
+  machine.processor->set_registers(vector.initial.registers);
+
+  unsigned int cycles = engine(machine.processor);
+
+  std::string differences;
+  auto compare = [&](const std::string &name, unsigned int actual,
+                     unsigned int expected) {
+    if (actual != expected) {
+      differences +=
+          fmt::format(" {}={:#x} (expected {:#x})", name, actual, expected);
+    }
+  };
+  const HuC6280::Registers &registers = machine.processor->get_registers();
+  const HuC6280::Registers &expected = vector.final.registers;
+  compare("pc", registers.program_counter.value,
+          expected.program_counter.value);
+  compare("s", registers.stack_pointer, expected.stack_pointer);
+  compare("a", registers.accumulator, expected.accumulator);
+  compare("x", registers.x, expected.x);
+  compare("y", registers.y, expected.y);
+  compare("p", registers.status.value, expected.status.value);
+  for (uint8_t i = 0; i < vector.final.mapping.size(); i++) {
+    compare(fmt::format("mpr{}", i), mapping_controller->mapping_register(i),
+            vector.final.mapping[i]);
+  }
+  for (const auto &[address, value] : vector.final.ram) {
+    compare(fmt::format("[{:#06x}]", address),
+            mapping_controller->peek(address), value);
+  }
+  compare("cycles", cycles, vector.cycles);
+
+  // Nothing is left behind for the next vector
+  for (const auto &[address, value] : vector.final.ram) {
+    mapping_controller->poke(address, 0);
+  }
+  SET_MAPPING(machine, vector.initial.mapping);
+  for (const auto &[address, value] : vector.initial.ram) {
+    mapping_controller->poke(address, 0);
+  }
+  return differences;
+}
+
+auto RUN_OPCODE(Machine &machine, const std::filesystem::path &directory,
+                uint8_t opcode) -> OpcodeResult {
+  OpcodeResult result = {};
+  std::filesystem::path path = directory / fmt::format("{:02x}.json", opcode);
+  if (!std::filesystem::exists(path)) {
+    return result;
+  }
+  result.found = true;
+  std::vector<TestVector> vectors;
+  try {
+    vectors = LOAD_VECTORS(path);
+  } catch (const nlohmann::json::exception &exception) {
+    result.failed++;
+    result.failures.push_back(
+        fmt::format("{}: {}", path.filename().string(), exception.what()));
+    return result;
+  }
+  for (const auto &[name, engine] : G_ENGINES) {
+    for (const auto &vector : vectors) {
+      if (!IS_SUPPORTED(vector)) {
+        result.skipped++;
+        continue;
+      }
+      std::string differences = RUN_VECTOR(machine, engine, vector);
+      if (differences.empty()) {
+        result.passed++;
+        continue;
+      }
+      if (result.failed++ < G_MAX_REPORTED_FAILURES) {
+        result.failures.push_back(
+            fmt::format("{:#04x} {} ({}):{}", opcode, vector.name, name,
+                        differences));
+      }
+    }
+  }
+  return result;
+}
+
+// SAKURA_TEST_VECTORS points at a full suite, the vectors next to this file
+// only cover a few opcodes
+auto GET_VECTORS_DIRECTORY() -> std::filesystem::path {
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const char *directory = std::getenv("SAKURA_TEST_VECTORS");
+  if (directory != nullptr) {
+    return directory;
+  }
+  return SAKURA_TEST_VECTORS_DIRECTORY;
+}
+
+TEST_CASE("Instructions match single step vectors", "[single_step]") {
+  Machine::register_null_loggers();
+  std::filesystem::path directory = GET_VECTORS_DIRECTORY();
+  std::vector<uint8_t> opcodes;
+  for (unsigned int opcode = 0; opcode < 0x100; opcode++) {
+    if (HuC6280::INTERPRETER_TABLE[opcode] != nullptr) {
+      opcodes.push_back(opcode);
+    }
+  }
+
+  // Opcodes are handed out to one machine per core, results are checked
+  // once every worker is done since assertions are not thread safe
+  std::vector<OpcodeResult> results(opcodes.size());
+  std::atomic<size_t> next(0);
+  unsigned int worker_count = std::max(std::thread::hardware_concurrency(), 1U);
+  std::vector<std::thread> workers;
+  for (unsigned int i = 0; i < worker_count; i++) {
+    workers.emplace_back([&] {
+      Machine machine = Machine();
+      // Stack operations need the stack pointer to have been set once
+      HuC6280::INTERPRETER_TABLE[G_TXS_OPCODE](machine.processor,
+                                                        G_TXS_OPCODE);
+      for (size_t index = next++; index < opcodes.size(); index = next++) {
+        results[index] = RUN_OPCODE(machine, directory, opcodes[index]);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  size_t found = 0;
+  size_t passed = 0;
+  size_t failed = 0;
+  size_t skipped = 0;
+  for (const auto &result : results) {
+    found += result.found ? 1 : 0;
+    passed += result.passed;
+    failed += result.failed;
+    skipped += result.skipped;
+    for (const auto &failure : result.failures) {
+      FAIL_CHECK(failure);
+    }
+  }
+  WARN(fmt::format("{}: {} of {} opcodes covered, {} vectors passed, {} "
+                   "failed, {} skipped",
+                   directory.string(), found, opcodes.size(), passed, failed,
+                   skipped));
+  REQUIRE(passed + failed > 0);
+  REQUIRE(failed == 0);
+}
@@ -0,0 +1,144 @@
+#include "TestEmulator.hpp"
+#include <Workloads.hpp>
+#include <catch2/catch.hpp>
+#include <memory>
+#include <sakura/Emulator.hpp>
+#include <sakura/RewindBuffer.hpp>
+#include <vector>
+
+using namespace Sakura;
+
+const size_t G_REWIND_TEST_CAPACITY = 1024 * 1024;
+const unsigned int G_REWIND_TEST_SNAPSHOTS = 8;
+const size_t G_RAM_LENGTH = 0x2000;
+
+auto MAKE_REWIND_TEST_EMULATOR() -> std::unique_ptr<Emulator> {
+  return Tests::MAKE_TEST_EMULATOR(
+      Workloads::GENERATE_WORKLOADS().front().rom);
+}
+
+auto SAVE_REWIND_TEST_STATE(const Emulator &emulator) -> std::vector<uint8_t> {
+  std::vector<uint8_t> state;
+  emulator.save_state(state);
+  return state;
+}
+
+// Rewinds through every snapshot the buffer holds, newest first, checking
+// each one loads exactly as it was pushed
+void CHECK_REWINDS(RewindBuffer &rewind_buffer, Emulator &emulator,
+                   const std::vector<std::vector<uint8_t>> &snapshots) {
+  REQUIRE(rewind_buffer.get_count() <= snapshots.size());
+  size_t count = rewind_buffer.get_count();
+  for (size_t i = 0; i < count; i++) {
+    INFO("Rewind " << i);
+    REQUIRE(rewind_buffer.rewind(emulator));
+    CHECK(SAVE_REWIND_TEST_STATE(emulator) ==
+          snapshots[snapshots.size() - 1 - i]);
+    CHECK(rewind_buffer.get_count() == std::max<size_t>(count - 1 - i, 1));
+  }
+}
+
+TEST_CASE("Rewinding restores every pushed snapshot", "[rewind]") {
+  std::unique_ptr<Emulator> emulator = MAKE_REWIND_TEST_EMULATOR();
+  RewindBuffer rewind_buffer(G_REWIND_TEST_CAPACITY, 1);
+  CHECK_FALSE(rewind_buffer.rewind(*emulator));
+
+  std::vector<std::vector<uint8_t>> snapshots;
+  for (unsigned int i = 0; i < G_REWIND_TEST_SNAPSHOTS; i++) {
+    emulator->emulate_frames(1);
+    rewind_buffer.push(*emulator);
+    snapshots.push_back(SAVE_REWIND_TEST_STATE(*emulator));
+  }
+  CHECK(rewind_buffer.get_count() == G_REWIND_TEST_SNAPSHOTS);
+  CHECK_REWINDS(rewind_buffer, *emulator, snapshots);
+
+  // The oldest snapshot stays loadable
+  REQUIRE(rewind_buffer.rewind(*emulator));
+  CHECK(SAVE_REWIND_TEST_STATE(*emulator) == snapshots.front());
+
+  rewind_buffer.clear();
+  CHECK(rewind_buffer.get_count() == 0);
+  CHECK_FALSE(rewind_buffer.rewind(*emulator));
+}
+
+TEST_CASE("Rewinding only snapshots every interval frames", "[rewind]") {
+  std::unique_ptr<Emulator> emulator = MAKE_REWIND_TEST_EMULATOR();
+  const unsigned int interval = 3;
+  RewindBuffer rewind_buffer(G_REWIND_TEST_CAPACITY, interval);
+  std::vector<std::vector<uint8_t>> snapshots;
+  for (unsigned int i = 0; i < G_REWIND_TEST_SNAPSHOTS * interval; i++) {
+    emulator->emulate_frames(1);
+    if (i % interval == 0) {
+      snapshots.push_back(SAVE_REWIND_TEST_STATE(*emulator));
+    }
+    rewind_buffer.push(*emulator);
+  }
+  CHECK(rewind_buffer.get_count() == G_REWIND_TEST_SNAPSHOTS);
+  CHECK_REWINDS(rewind_buffer, *emulator, snapshots);
+}
+
+TEST_CASE("Rewinding restores changes at the edges of runs", "[rewind]") {
+  std::unique_ptr<Emulator> emulator = MAKE_REWIND_TEST_EMULATOR();
+  emulator->emulate_frames(1);
+  std::vector<uint8_t> base = SAVE_REWIND_TEST_STATE(*emulator);
+  size_t ram = Tests::FIND_STATE_RAM(base);
+
+  // Single bytes at the start and the end of RAM, a byte on each side of a
+  // word boundary and a literal run as long as RAM
+  std::vector<std::vector<uint8_t>> snapshots = {base};
+  for (size_t offset : {size_t(0), G_RAM_LENGTH - 1, size_t(0x107),
+                        size_t(0x108)}) {
+    snapshots.push_back(snapshots.back());
+    snapshots.back()[ram + offset] ^= 0xA5;
+  }
+  snapshots.push_back(snapshots.back());
+  for (size_t offset = 0; offset < G_RAM_LENGTH; offset++) {
+    snapshots.back()[ram + offset] = offset & 0xFF;
+  }
+  snapshots.push_back(base);
+
+  RewindBuffer rewind_buffer(G_REWIND_TEST_CAPACITY, 1);
+  for (const auto &snapshot : snapshots) {
+    REQUIRE(emulator->load_state(snapshot));
+    REQUIRE(SAVE_REWIND_TEST_STATE(*emulator) == snapshot);
+    rewind_buffer.push(*emulator);
+  }
+  CHECK(rewind_buffer.get_count() == snapshots.size());
+  CHECK_REWINDS(rewind_buffer, *emulator, snapshots);
+}
+
+TEST_CASE("Rewinding drops the oldest snapshots when full", "[rewind]") {
+  std::unique_ptr<Emulator> emulator = MAKE_REWIND_TEST_EMULATOR();
+  std::vector<std::vector<uint8_t>> snapshots;
+  auto push_frames = [&](RewindBuffer &rewind_buffer, unsigned int frames) {
+    for (unsigned int i = 0; i < frames; i++) {
+      emulator->emulate_frames(1);
+      rewind_buffer.push(*emulator);
+      snapshots.push_back(SAVE_REWIND_TEST_STATE(*emulator));
+    }
+  };
+
+  // Sized from a delta between two frames, once the workload has uploaded its
+  // scene every frame changes about as much
+  emulator->emulate_frames(G_REWIND_TEST_SNAPSHOTS);
+  RewindBuffer measure(G_REWIND_TEST_CAPACITY, 1);
+  push_frames(measure, 2);
+  size_t delta_length = measure.get_used_bytes();
+  REQUIRE(delta_length > 0);
+
+  SECTION("Deltas wrap around the arena") {
+    RewindBuffer rewind_buffer(delta_length * 7 / 2, 1);
+    push_frames(rewind_buffer, G_REWIND_TEST_SNAPSHOTS * 4);
+    CHECK(rewind_buffer.get_used_bytes() <= rewind_buffer.get_capacity());
+    CHECK(rewind_buffer.get_count() > 1);
+    CHECK(rewind_buffer.get_count() < G_REWIND_TEST_SNAPSHOTS);
+    CHECK_REWINDS(rewind_buffer, *emulator, snapshots);
+  }
+  SECTION("Deltas longer than the arena") {
+    RewindBuffer rewind_buffer(delta_length / 2, 1);
+    push_frames(rewind_buffer, G_REWIND_TEST_SNAPSHOTS);
+    CHECK(rewind_buffer.get_used_bytes() == 0);
+    CHECK(rewind_buffer.get_count() == 1);
+    CHECK_REWINDS(rewind_buffer, *emulator, snapshots);
+  }
+}
@@ -0,0 +1,172 @@
+#include "State.hpp"
+#include "TestEmulator.hpp"
+#include <Workloads.hpp>
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <memory>
+#include <sakura/Emulator.hpp>
+#include <vector>
+
+using namespace Sakura;
+
+const uint32_t G_TEST_STATE_TAG = STATE_TAG("TEST");
+const uint64_t G_STATE_TEST_FRAMES = 10;
+
+auto MAKE_STATE_TEST_EMULATOR() -> std::unique_ptr<Emulator> {
+  return Tests::MAKE_TEST_EMULATOR(
+      Workloads::GENERATE_WORKLOADS().front().rom);
+}
+
+auto SAVE_TEST_STATE() -> std::vector<uint8_t> {
+  std::vector<uint8_t> state;
+  StateWriter writer(state);
+  writer.begin_section(G_TEST_STATE_TAG);
+  writer.write(uint32_t(0x12345678));
+  writer.write(uint16_t(0xABCD));
+  writer.end_section();
+  return state;
+}
+
+TEST_CASE("State sections read back what was written", "[state]") {
+  std::vector<uint8_t> state = SAVE_TEST_STATE();
+  StateReader reader(state);
+  REQUIRE(reader.is_valid());
+  REQUIRE(reader.open_section(G_TEST_STATE_TAG));
+  uint32_t word = 0;
+  uint16_t half_word = 0;
+  reader.read(word);
+  reader.read(half_word);
+  CHECK(reader.is_valid());
+  CHECK(word == 0x12345678);
+  CHECK(half_word == 0xABCD);
+
+  // Reads can't go past the end of the section
+  uint8_t byte = 0;
+  reader.read(byte);
+  CHECK_FALSE(reader.is_valid());
+}
+
+TEST_CASE("State readers reject other snapshots", "[state]") {
+  std::vector<uint8_t> state = SAVE_TEST_STATE();
+
+  SECTION("Magic") {
+    state[0] ^= 0xFF;
+    CHECK_FALSE(StateReader(state).is_valid());
+  }
+  SECTION("Version") {
+    uint32_t version = STATE_VERSION + 1;
+    std::memcpy(state.data() + sizeof(uint32_t), &version, sizeof(version));
+    CHECK_FALSE(StateReader(state).is_valid());
+  }
+  SECTION("Section tag") {
+    StateReader reader(state);
+    CHECK_FALSE(reader.open_section(STATE_TAG("NONE")));
+    CHECK_FALSE(reader.is_valid());
+  }
+  SECTION("Truncated") {
+    for (size_t length = 0; length < state.size(); length++) {
+      std::vector<uint8_t> truncated(state.begin(), state.begin() + length);
+      INFO("Truncated to " << length << " bytes");
+      StateReader reader(truncated);
+      // Only the header left is a snapshot without sections
+      CHECK_FALSE(reader.open_section(G_TEST_STATE_TAG));
+    }
+  }
+}
+
+TEST_CASE("Emulator snapshots round trip", "[state]") {
+  std::unique_ptr<Emulator> emulator = MAKE_STATE_TEST_EMULATOR();
+  emulator->emulate_frames(G_STATE_TEST_FRAMES);
+  std::vector<uint8_t> saved;
+  emulator->save_state(saved);
+
+  // Loaded into an emulator that is somewhere else
+  std::unique_ptr<Emulator> loaded = MAKE_STATE_TEST_EMULATOR();
+  loaded->emulate_frames(1);
+  REQUIRE(loaded->load_state(saved));
+  std::vector<uint8_t> resaved;
+  loaded->save_state(resaved);
+  CHECK(resaved == saved);
+  CHECK(loaded->get_frame() == emulator->get_frame());
+
+  // And they keep running in step
+  emulator->emulate_frames(1);
+  loaded->emulate_frames(1);
+  emulator->save_state(saved);
+  loaded->save_state(resaved);
+  CHECK(resaved == saved);
+}
+
+TEST_CASE("Emulators in the same state save the same bytes", "[state]") {
+  // Padding would carry whatever was in memory into the snapshot
+  std::unique_ptr<Emulator> first = MAKE_STATE_TEST_EMULATOR();
+  std::unique_ptr<Emulator> second = MAKE_STATE_TEST_EMULATOR();
+  for (uint64_t i = 0; i < G_STATE_TEST_FRAMES; i++) {
+    first->emulate_frames(1);
+    second->emulate_frames(1);
+    std::vector<uint8_t> first_state;
+    std::vector<uint8_t> second_state;
+    first->save_state(first_state);
+    second->save_state(second_state);
+    REQUIRE(first_state == second_state);
+  }
+}
+
+TEST_CASE("Emulators reject bad snapshots", "[state]") {
+  // Taken a frame before the emulator is at, so a partial load would show
+  std::unique_ptr<Emulator> emulator = MAKE_STATE_TEST_EMULATOR();
+  emulator->emulate_frames(G_STATE_TEST_FRAMES);
+  std::vector<uint8_t> state;
+  emulator->save_state(state);
+  emulator->emulate_frames(1);
+  std::vector<uint8_t> current;
+  emulator->save_state(current);
+
+  // Offsets of every section header
+  std::vector<size_t> sections;
+  for (size_t position = sizeof(uint32_t) * 2; position < state.size();) {
+    sections.push_back(position);
+    uint32_t size = 0;
+    std::memcpy(&size, state.data() + position + sizeof(uint32_t),
+                sizeof(size));
+    position += sizeof(uint32_t) * 2 + size;
+  }
+  REQUIRE(sections.size() > 2);
+
+  SECTION("Version") {
+    uint32_t version = STATE_VERSION - 1;
+    std::memcpy(state.data() + sizeof(uint32_t), &version, sizeof(version));
+  }
+  SECTION("Section tag") {
+    // The first section is the emulator's own
+    std::memcpy(state.data() + sections.front(), "NONE", 4);
+  }
+  SECTION("Last section tag") {
+    std::memcpy(state.data() + sections.back(), "NONE", 4);
+  }
+  SECTION("Short section") {
+    // The byte is dropped from the payload and the section size, so every
+    // section is still found
+    size_t position = sections[sections.size() / 2];
+    uint32_t size = 0;
+    std::memcpy(&size, state.data() + position + sizeof(uint32_t),
+                sizeof(size));
+    size--;
+    std::memcpy(state.data() + position + sizeof(uint32_t), &size,
+                sizeof(size));
+    state.erase(state.begin() +
+                static_cast<std::ptrdiff_t>(position + sizeof(uint32_t) * 2));
+  }
+  SECTION("Truncated inside a section") { state.resize(state.size() - 1); }
+  SECTION("Truncated between sections") {
+    // Drops the last section whole, every section left is complete
+    state.resize(sections.back());
+  }
+  SECTION("Empty") { state.clear(); }
+
+  CHECK_FALSE(emulator->load_state(state));
+  // Nothing of the rejected snapshot was loaded
+  std::vector<uint8_t> after;
+  emulator->save_state(after);
+  CHECK(after == current);
+}
@@ -0,0 +1,48 @@
+#include "TestEmulator.hpp"
+#include "State.hpp"
+#include <catch2/catch.hpp>
+#include <cstring>
+
+using namespace Sakura;
+
+const uint32_t G_MEMORY_STATE_TAG = STATE_TAG("MMU ");
+const size_t G_RAM_OFFSET = 8;
+
+auto Sakura::Tests::MAKE_TEST_EMULATOR(const std::vector<uint8_t> &rom)
+    -> std::unique_ptr<Emulator> {
+  LogLevelConfig log_level_config = {.disassembler = "off",
+                                     .interrupt_controller = "off",
+                                     .io = "off",
+                                     .mapping_controller = "off",
+                                     .processor = "off",
+                                     .programmable_sound_generator = "off",
+                                     .timer = "off",
+                                     .video_color_encoder = "off",
+                                     .video_display_controller = "off",
+                                     .block_transfer_instruction = "off",
+                                     .stack = "off"};
+  auto emulator = std::make_unique<Emulator>(
+      VDCConfig{.deadbeef_vram = false}, MOS6502ModeConfig{.enabled = false});
+  emulator->initialize(rom, log_level_config,
+                       LogFormatterConfig{.enabled = false});
+  return emulator;
+}
+
+auto Sakura::Tests::FIND_STATE_RAM(const std::vector<uint8_t> &state)
+    -> size_t {
+  size_t position = sizeof(uint32_t) * 2;
+  while (position < state.size()) {
+    uint32_t section_tag = 0;
+    uint32_t size = 0;
+    std::memcpy(&section_tag, state.data() + position, sizeof(section_tag));
+    std::memcpy(&size, state.data() + position + sizeof(uint32_t),
+                sizeof(size));
+    position += sizeof(uint32_t) * 2;
+    if (section_tag == G_MEMORY_STATE_TAG) {
+      return position + G_RAM_OFFSET;
+    }
+    position += size;
+  }
+  FAIL("Memory controller section not found");
+  return 0;
+}
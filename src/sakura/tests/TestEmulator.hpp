@@ -0,0 +1,20 @@
+#ifndef SAKURA_TEST_EMULATOR_HPP
+#define SAKURA_TEST_EMULATOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <sakura/Emulator.hpp>
+#include <vector>
+
+namespace Sakura::Tests {
+
+// Initialized with a ROM image and every logger off. Loggers are registered
+// globally, so emulators are only made on the main thread
+auto MAKE_TEST_EMULATOR(const std::vector<uint8_t> &rom)
+    -> std::unique_ptr<Emulator>;
+// Offset of the RAM in a snapshot, it follows the mapping registers in the
+// memory controller section
+auto FIND_STATE_RAM(const std::vector<uint8_t> &state) -> size_t;
+}; // namespace Sakura::Tests
+
+#endif
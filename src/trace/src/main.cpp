@@ -0,0 +1,92 @@
+#include <cstdlib>
+#include <fmt/core.h>
+#include <iostream>
+#include <sakura/Emulator.hpp>
+#include <sakura/TraceBuffer.hpp>
+#include <unistd.h>
+
+void print_usage() {
+  std::cout << "Usage: sakura-trace [-h] [-n count] trace.bin" << std::endl;
+  std::cout << "" << std::endl;
+  std::cout << "  -h   print this message" << std::endl;
+  std::cout << "  -n   only decode the latest number of records"
+            << std::endl;
+  std::cout << "" << std::endl;
+}
+
+auto main(int argc, char *argv[]) -> int {
+  uint64_t count = 0;
+  int c;
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  while ((c = getopt(argc, argv, "hn:")) != -1) {
+    switch (c) {
+    case 'h':
+      print_usage();
+      return 0;
+    case 'n':
+      count = std::strtoull(optarg, nullptr, 10);
+      break;
+    default:
+      print_usage();
+      return 1;
+    }
+  }
+  if (optind >= argc) {
+    print_usage();
+    std::cout << "Missing argument: trace filepath." << std::endl;
+    return 1;
+  }
+
+  std::vector<Sakura::TraceRecord> records;
+  uint64_t skipped = 0;
+  if (!Sakura::TraceBuffer::load(argv[optind], records, skipped)) {
+    std::cout << "Unable to load trace: " << argv[optind] << std::endl;
+    return 1;
+  }
+  if (count != 0 && count < records.size()) {
+    skipped += records.size() - count;
+    records.erase(records.begin(), records.end() - count);
+  }
+
+  // Only the disassembler is used, it runs on an empty machine
+  Sakura::LogLevelConfig log_level_config = {
+      .disassembler = "critical",
+      .interrupt_controller = "critical",
+      .io = "critical",
+      .mapping_controller = "critical",
+      .processor = "critical",
+      .programmable_sound_generator = "critical",
+      .timer = "critical",
+      .video_color_encoder = "critical",
+      .video_display_controller = "critical",
+      .block_transfer_instruction = "critical",
+      .stack = "critical"};
+  Sakura::LogFormatterConfig log_formatter_config = {.enabled = true};
+  Sakura::VDCConfig vdc_config = {.deadbeef_vram = false};
+  Sakura::MOS6502ModeConfig mos_6502_mode_config = {.enabled = false};
+  Sakura::Emulator emulator =
+      Sakura::Emulator(vdc_config, mos_6502_mode_config);
+  emulator.initialize(std::vector<uint8_t>(), log_level_config,
+                      log_formatter_config);
+
+  std::cout << fmt::format("; {} records, {} older ones not shown",
+                           records.size(), skipped)
+            << std::endl;
+  for (size_t i = 0; i < records.size(); i++) {
+    // Extensions carry the cycle of the instruction that follows them
+    const Sakura::TraceRecord *extension = nullptr;
+    if (i + 1 < records.size() && records[i + 1].cycle == records[i].cycle) {
+      extension = &records[i++];
+    }
+    const Sakura::TraceRecord &record = records[i];
+    std::cout << fmt::format(
+                     "{:>10}  {:02X}:{:04X}  A:{:02X} X:{:02X} Y:{:02X} "
+                     "S:{:02X} P:{:02X}  {}",
+                     record.cycle, record.bank, record.program_counter,
+                     record.accumulator, record.x, record.y,
+                     record.stack_pointer, record.status,
+                     emulator.disassemble(record, extension))
+              << '\n';
+  }
+  return 0;
+}